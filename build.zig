@@ -21,6 +21,49 @@ fn os_from_string(os_string: []const u8) !std.Target.Os.Tag {
     unreachable;
 }
 
+// Makes every file under dir_path (relative to the build root) with the given extension an input of the step,
+// so the step only re-runs when one of them is added, removed or changed.
+fn add_file_inputs(b: *std.Build, run: *std.Build.Step.Run, dir_path: []const u8, extension: []const u8) !void {
+    var dir = try b.build_root.handle.openDir(dir_path, .{ .iterate = true });
+    defer dir.close();
+
+    var walker = try dir.walk(b.allocator);
+    defer walker.deinit();
+
+    while (try walker.next()) |entry| {
+        if (entry.kind == .file and std.mem.endsWith(u8, entry.basename, extension)) {
+            run.addFileInput(b.path(b.pathJoin(&.{ dir_path, entry.path })));
+        }
+    }
+}
+
+const AssetCodegen = struct {
+    run: *std.Build.Step.Run, // To add more arguments to the script.
+    step: *std.Build.Step, // Done once the generated file is in src/.
+};
+
+// Runs an asset code generator as a cached step, and copies its output into src/, where the game imports it from.
+// The copy carries the cached file's timestamp along, so src/ is only touched again once the generator produces
+// something new, which is why the scripts themselves just overwrite their output.
+fn add_asset_codegen(
+    b: *std.Build,
+    script_path: []const u8,
+    asset_dir_path: []const u8,
+    extension: []const u8,
+    output_path: []const u8,
+) !AssetCodegen {
+    const generate = b.addSystemCommand(&[_][]const u8{"python3"});
+    generate.addFileArg(b.path(script_path));
+    generate.setCwd(b.path("."));
+    const generated = generate.addOutputFileArg(std.fs.path.basename(output_path));
+    try add_file_inputs(b, generate, asset_dir_path, extension);
+
+    const update_source = b.addUpdateSourceFiles();
+    update_source.addCopyFileToSource(generated, output_path);
+
+    return .{ .run = generate, .step = &update_source.step };
+}
+
 pub fn build(b: *std.Build) !void {
     // NOTE:
     //      Trying to use the `b.resolveTargetQuery` function to manually resolve the target architecture and operating system.
@@ -53,6 +96,43 @@ pub fn build(b: *std.Build) !void {
 
     const optimize = b.standardOptimizeOption(.{ .preferred_optimize_mode = .Debug });
 
+    const software_rendering = b.option(
+        bool,
+        "software_rendering",
+        "Composite frames on the CPU and present them with a single texture update, for machines without a GPU.",
+    ) orelse false;
+
+    const texture_budget_mb = b.option(
+        u32,
+        "texture_budget_mb",
+        "Texture memory kept resident before the least recently drawn asset groups get evicted.",
+    ) orelse 256;
+
+    const audio_buffer_frames = b.option(
+        u16,
+        "audio_buffer_frames",
+        "Frames per audio device buffer. 256 or 512 for low latency, check the underruns reported on exit.",
+    ) orelse 1024;
+
+    const profile_frames = b.option(
+        u32,
+        "profile_frames",
+        "Record this many frames of profiler zones and write them to profile.json as a Chrome trace. 0 compiles zones out.",
+    ) orelse 0;
+
+    const profile_first_frame = b.option(
+        u32,
+        "profile_first_frame",
+        "First frame the profiler records, to skip startup or get to a match.",
+    ) orelse 0;
+
+    const build_options = b.addOptions();
+    build_options.addOption(bool, "software_rendering", software_rendering);
+    build_options.addOption(u32, "texture_budget_mb", texture_budget_mb);
+    build_options.addOption(u16, "audio_buffer_frames", audio_buffer_frames);
+    build_options.addOption(u32, "profile_frames", profile_frames);
+    build_options.addOption(u32, "profile_first_frame", profile_first_frame);
+
     const exe = b.addExecutable(.{
         .name = "battlebuds",
         .root_source_file = b.path("src/main.zig"),
@@ -60,6 +140,7 @@ pub fn build(b: *std.Build) !void {
         .optimize = optimize,
     });
 
+    exe.root_module.addOptions("build_options", build_options);
     exe.linkSystemLibrary("hidapi-libusb");
     // exe.addLibraryPath(std.Build.LazyPath{ .cwd_relative = "/usr/lib/x86_64-linux-gnu" });
 
@@ -75,12 +156,142 @@ pub fn build(b: *std.Build) !void {
         }).module("rgbapng"),
     );
 
-    // Make building excutable depend on running python scripts.
-    const generate_visual_assets = b.addSystemCommand(&[_][]const u8{ "python3", "src/visual_assets.py" });
-    const generate_audio_assets = b.addSystemCommand(&[_][]const u8{ "python3", "src/audio_assets.py" });
+    // Make building excutable depend on running python scripts, whenever the assets (or the scripts) change.
+    const generate_visual_assets = try add_asset_codegen(b, "src/visual_assets.py", "assets/visual", ".png", "src/visual_assets.zig");
+    const generate_audio_assets = try add_asset_codegen(b, "src/audio_assets.py", "assets/audio", ".wav", "src/audio_assets.zig");
+
+    exe.step.dependOn(generate_visual_assets.step);
+    exe.step.dependOn(generate_audio_assets.step);
+
+    // The audio script also converts every sound to the format the game mixes in, so it never resamples at runtime.
+    const converted_audio = generate_audio_assets.run.addOutputDirectoryArg("converted_audio");
+
+    // Then the converted sounds are ADPCM encoded, which the mixer decodes as it plays them.
+    const encode_tool = b.addExecutable(.{
+        .name = "encode_audio",
+        .root_source_file = b.path("src/encode_audio.zig"),
+        .target = b.graph.host,
+        .optimize = .ReleaseFast,
+    });
+
+    const encode_audio_assets = b.addRunArtifact(encode_tool);
+    encode_audio_assets.addDirectoryArg(converted_audio);
+
+    // Installed in an audio/ directory next to the executable, where the game looks for it. A missing sound is
+    // reported and the game plays without it.
+    b.getInstallStep().dependOn(&b.addInstallDirectory(.{
+        .source_dir = encode_audio_assets.addOutputDirectoryArg("encoded_audio"),
+        .install_dir = .bin,
+        .install_subdir = "audio",
+    }).step);
 
-    exe.step.dependOn(&generate_visual_assets.step);
-    exe.step.dependOn(&generate_audio_assets.step);
+    // Decode every PNG once at build time, into a pack the game maps at startup instead of decoding.
+    const pack_tool = b.addExecutable(.{
+        .name = "pack_assets",
+        .root_source_file = b.path("src/pack_assets.zig"),
+        .target = b.graph.host,
+        .optimize = .ReleaseFast,
+    });
+    const host_rgbapng = b.dependency("rgbapng", .{
+        .target = b.graph.host,
+        .optimize = .ReleaseFast,
+    }).module("rgbapng");
+
+    pack_tool.root_module.addImport("sdl2", sdk.getNativeModule());
+    pack_tool.root_module.addImport("rgbapng", host_rgbapng);
+    pack_tool.step.dependOn(generate_visual_assets.step);
+
+    const pack_visual_assets = b.addRunArtifact(pack_tool);
+    pack_visual_assets.setCwd(b.path("."));
+    const visual_asset_pack = pack_visual_assets.addOutputFileArg("visual_assets.pack");
+
+    // The pack only needs rebuilding when an asset changes, so let the cache see every PNG.
+    try add_file_inputs(b, pack_visual_assets, "assets/visual", ".png");
+
+    // Installed next to the executable, where the game looks for it. If it goes missing, the game falls back to
+    // decoding the PNGs.
+    b.getInstallStep().dependOn(&b.addInstallBinFile(visual_asset_pack, "visual_assets.pack").step);
+
+    // Compare the pack's compression with decoding PNGs.
+    const bench = b.addExecutable(.{
+        .name = "bench_assets",
+        .root_source_file = b.path("src/bench_assets.zig"),
+        .target = b.graph.host,
+        .optimize = .ReleaseFast,
+    });
+    bench.root_module.addImport("sdl2", sdk.getNativeModule());
+    bench.root_module.addImport("rgbapng", host_rgbapng);
+    bench.step.dependOn(generate_visual_assets.step);
+
+    const run_bench = b.addRunArtifact(bench);
+    run_bench.setCwd(b.path("."));
+
+    // Mixing throughput of the audio callback's kernels.
+    const bench_audio = b.addExecutable(.{
+        .name = "bench_audio",
+        .root_source_file = b.path("src/bench_audio.zig"),
+        .target = b.graph.host,
+        .optimize = .ReleaseFast,
+    });
+    bench_audio.root_module.addImport("sdl2", sdk.getNativeModule());
+    bench_audio.root_module.addOptions("build_options", build_options);
+    bench_audio.step.dependOn(generate_audio_assets.step);
+
+    const run_bench_audio = b.addRunArtifact(bench_audio);
+
+    // How the software renderer's compositor scales with the number of workers.
+    const bench_render = b.addExecutable(.{
+        .name = "bench_render",
+        .root_source_file = b.path("src/bench_render.zig"),
+        .target = b.graph.host,
+        .optimize = .ReleaseFast,
+    });
+    bench_render.root_module.addImport("sdl2", sdk.getNativeModule());
+
+    const run_bench_render = b.addRunArtifact(bench_render);
+
+    const bench_step = b.step("bench", "Benchmark asset pack compression against PNG decoding, audio mixing, and compositing");
+    bench_step.dependOn(&run_bench.step);
+    bench_step.dependOn(&run_bench_audio.step);
+    bench_step.dependOn(&run_bench_render.step);
+
+    // Each module's tests, built with the same imports and generated assets as the game.
+    const test_step = b.step("test", "Run the unit tests");
+    const tested_modules = [_][]const u8{
+        "src/adpcm.zig",
+        "src/audio.zig",
+        "src/frame_stats.zig",
+        "src/lz4.zig",
+        "src/mpsc_queue.zig",
+        "src/render.zig",
+        "src/software_render.zig",
+        "src/stages.zig",
+        "src/utils.zig",
+        "src/work_pool.zig",
+    };
+
+    for (tested_modules) |module_path| {
+        const module_tests = b.addTest(.{
+            .root_source_file = b.path(module_path),
+            .target = target,
+            .optimize = optimize,
+        });
+
+        module_tests.root_module.addOptions("build_options", build_options);
+        sdk.link(module_tests, .static, sdl.Library.SDL2);
+        module_tests.root_module.addImport("sdl2", sdk.getNativeModule());
+        module_tests.root_module.addImport(
+            "rgbapng",
+            b.dependency("rgbapng", .{
+                .target = target,
+                .optimize = optimize,
+            }).module("rgbapng"),
+        );
+        module_tests.step.dependOn(generate_visual_assets.step);
+        module_tests.step.dependOn(generate_audio_assets.step);
+
+        test_step.dependOn(&b.addRunArtifact(module_tests).step);
+    }
 
     b.installArtifact(exe);
 
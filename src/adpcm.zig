@@ -0,0 +1,170 @@
+/// IMA ADPCM for 48 kHz stereo sounds, 4 bits per sample instead of 16. Written at build time by encode_audio.zig,
+/// and decoded by the mixer a block at a time as it plays.
+/// Layout: a Header, then blocks of BLOCK_FRAMES frames. Each block starts both channels' predictor state over,
+/// so any block decodes on its own: per channel, the predictor (i16), the step index (u8), a padding byte,
+/// then BLOCK_FRAMES 4 bit codes, low nibble first. The last block is padded with silence.
+const std = @import("std");
+
+pub const MAGIC = "BBADPCM1".*;
+pub const CHANNELS = 2;
+pub const BLOCK_FRAMES = 256;
+const CHANNEL_SIZE = 4 + BLOCK_FRAMES / 2;
+pub const BLOCK_SIZE = CHANNELS * CHANNEL_SIZE;
+
+pub const Frame = [CHANNELS]i16;
+pub const Block = [BLOCK_SIZE]u8;
+
+pub const Header = extern struct {
+    magic: [8]u8 = MAGIC,
+    frequency: u32,
+    num_frames: u32,
+};
+
+pub fn numBlocks(num_frames: usize) usize {
+    return std.math.divCeil(usize, num_frames, BLOCK_FRAMES) catch unreachable;
+}
+
+// A whole encoded file, in memory.
+pub const Sound = struct {
+    blocks: []const Block,
+    num_frames: usize,
+
+    // Returns null if the bytes aren't a complete sound at the given frequency.
+    pub fn fromBytes(bytes: []const u8, frequency: u32) ?Sound {
+        if (bytes.len < @sizeOf(Header)) return null;
+
+        const header = std.mem.bytesToValue(Header, bytes[0..@sizeOf(Header)]);
+        const num_blocks = numBlocks(header.num_frames);
+
+        if (!std.mem.eql(u8, &header.magic, &MAGIC) or header.frequency != frequency) return null;
+        if (bytes.len != @sizeOf(Header) + num_blocks * BLOCK_SIZE) return null;
+
+        const blocks: [*]const Block = @ptrCast(bytes[@sizeOf(Header)..].ptr);
+        return .{ .blocks = blocks[0..num_blocks], .num_frames = header.num_frames };
+    }
+};
+
+const STEPS = [89]i32{
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+const STEP_INDEX_CHANGES = [8]i32{ -1, -1, -1, -1, 2, 4, 6, 8 };
+
+const ChannelState = struct {
+    predictor: i32 = 0,
+    step_index: i32 = 0,
+
+    fn decode(self: *ChannelState, code: u4) i16 {
+        const step = STEPS[@intCast(self.step_index)];
+        var difference = step >> 3;
+
+        if (code & 1 != 0) difference += step >> 2;
+        if (code & 2 != 0) difference += step >> 1;
+        if (code & 4 != 0) difference += step;
+
+        if (code & 8 != 0) self.predictor -= difference else self.predictor += difference;
+
+        self.predictor = std.math.clamp(self.predictor, std.math.minInt(i16), std.math.maxInt(i16));
+        self.step_index = std.math.clamp(self.step_index + STEP_INDEX_CHANGES[code & 7], 0, STEPS.len - 1);
+
+        return @intCast(self.predictor);
+    }
+
+    // Picks the code that gets closest to the sample, then decodes it, so the state follows the decoder's exactly.
+    fn encode(self: *ChannelState, sample: i16) u4 {
+        const step = STEPS[@intCast(self.step_index)];
+        var difference = @as(i32, sample) - self.predictor;
+        var code: u4 = 0;
+
+        if (difference < 0) {
+            code = 8;
+            difference = -difference;
+        }
+        if (difference >= step) {
+            code |= 4;
+            difference -= step;
+        }
+        if (difference >= step >> 1) {
+            code |= 2;
+            difference -= step >> 1;
+        }
+        if (difference >= step >> 2) {
+            code |= 1;
+        }
+
+        _ = self.decode(code);
+        return code;
+    }
+};
+
+pub fn decodeBlock(block: *const Block, frames: *[BLOCK_FRAMES]Frame) void {
+    for (0..CHANNELS) |channel| {
+        const data = block[channel * CHANNEL_SIZE ..][0..CHANNEL_SIZE];
+        var state = ChannelState{
+            .predictor = std.mem.readInt(i16, data[0..2], .little),
+            .step_index = @min(data[2], STEPS.len - 1),
+        };
+
+        for (data[4..], 0..) |codes, i| {
+            frames[2 * i][channel] = state.decode(@truncate(codes));
+            frames[2 * i + 1][channel] = state.decode(@truncate(codes >> 4));
+        }
+    }
+}
+
+// Carries the encoder's state from block to block, which the decoder gets back from each block's header.
+pub const Encoder = struct {
+    states: [CHANNELS]ChannelState = .{ChannelState{}} ** CHANNELS,
+
+    // frames can be shorter than a block, for the last one.
+    pub fn encodeBlock(self: *Encoder, frames: []const Frame, block: *Block) void {
+        for (&self.states, 0..) |*state, channel| {
+            const data = block[channel * CHANNEL_SIZE ..][0..CHANNEL_SIZE];
+
+            std.mem.writeInt(i16, data[0..2], @intCast(state.predictor), .little);
+            data[2] = @intCast(state.step_index);
+            data[3] = 0;
+
+            for (data[4..], 0..) |*codes, i| {
+                const first = if (2 * i < frames.len) frames[2 * i][channel] else 0;
+                const second = if (2 * i + 1 < frames.len) frames[2 * i + 1][channel] else 0;
+
+                codes.* = state.encode(first) | @as(u8, state.encode(second)) << 4;
+            }
+        }
+    }
+};
+
+test "ADPCM round trip stays close to the original" {
+    var frames: [3 * BLOCK_FRAMES]Frame = undefined;
+    for (&frames, 0..) |*frame, i| {
+        const phase = @as(f32, @floatFromInt(i)) * 0.05;
+        frame.* = .{ @intFromFloat(@sin(phase) * 12000), @intFromFloat(@cos(phase * 1.3) * 8000) };
+    }
+
+    var encoder = Encoder{};
+    var decoded: [BLOCK_FRAMES]Frame = undefined;
+
+    for (0..frames.len / BLOCK_FRAMES) |block_index| {
+        const block_frames = frames[block_index * BLOCK_FRAMES ..][0..BLOCK_FRAMES];
+        var block: Block = undefined;
+
+        encoder.encodeBlock(block_frames, &block);
+        decodeBlock(&block, &decoded);
+
+        // Past the first few samples, where the step size is still adapting.
+        for (block_frames[16..], decoded[16..]) |original, result| {
+            for (original, result) |original_sample, result_sample| {
+                try std.testing.expect(@abs(@as(i32, original_sample) - result_sample) < 1000);
+            }
+        }
+    }
+}
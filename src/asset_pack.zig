@@ -0,0 +1,184 @@
+/// Pre-decoded visual assets, written once at build time by pack_assets.zig and memory mapped by the game.
+/// Layout: a Header, one Entry per element of visual_assets.ALL (same order), the Chunk table,
+/// then the compressed chunks. Each asset's trimmed RGBA pixels (rows tightly packed) are split into
+/// CHUNK_SIZE pieces, LZ4 compressed independently so they can be decompressed in parallel.
+/// Duplicate frames (Asset.duplicate_of) have an entry without chunks, since their pixels are never loaded.
+/// Frames of delta encoded animations (visual_assets.DELTA_CANVAS_PER_ID) store only the region of the canvas
+/// that changed since the previous frame, except for the first frame which stores the whole canvas.
+/// Frames with at most 256 colours are stored indexed: their palette, then one byte per pixel.
+const std = @import("std");
+const builtin = @import("builtin");
+const lz4 = @import("lz4.zig");
+
+pub const MAGIC = "BBUDPACK".*;
+pub const VERSION: u32 = 5;
+pub const CHUNK_SIZE = 256 * 1024;
+
+pub const Header = extern struct {
+    magic: [8]u8 = MAGIC,
+    version: u32 = VERSION,
+    num_entries: u32,
+    num_chunks: u32,
+    padding: u32 = 0,
+};
+
+pub const Rect = extern struct {
+    x: u16 = 0,
+    y: u16 = 0,
+    width: u16 = 0,
+    height: u16 = 0,
+
+    pub fn contains(self: Rect, other: Rect) bool {
+        return other.x >= self.x and other.y >= self.y and
+            other.x + other.width <= self.x + self.width and
+            other.y + other.height <= self.y + self.height;
+    }
+};
+
+pub const Entry = extern struct {
+    offset: u64, // Of the first chunk, from the start of the file. An asset's chunks are contiguous.
+    size: u64, // Of all chunks.
+    width: u16, // Of the stored pixels.
+    height: u16,
+    first_chunk: u32,
+    num_chunks: u32,
+    // Delta encoded frames only. Where the frame differs from the previous one (the first frame follows the last),
+    // relative to the canvas. Frames after the first store exactly this rectangle.
+    changed: Rect = .{},
+    palette_size: u16 = 0, // Number of colours of an indexed frame, 0 for RGBA.
+    padding: u16 = 0,
+
+    pub fn isStored(self: Entry) bool {
+        return self.num_chunks > 0;
+    }
+
+    pub fn isIndexed(self: Entry) bool {
+        return self.palette_size > 0;
+    }
+
+    pub fn numPixels(self: Entry) usize {
+        return @as(usize, self.width) * self.height;
+    }
+
+    pub fn rawSize(self: Entry) usize {
+        if (self.isIndexed()) return @as(usize, self.palette_size) * @sizeOf(u32) + self.numPixels();
+        return self.numPixels() * @sizeOf(u32);
+    }
+};
+
+pub const Chunk = extern struct {
+    offset: u64,
+    size: u32, // Equal to raw_size if the chunk didn't compress, and is stored as is.
+    raw_size: u32,
+};
+
+pub fn numChunks(raw_size: usize) usize {
+    return @max(1, std.math.divCeil(usize, raw_size, CHUNK_SIZE) catch unreachable);
+}
+
+pub fn firstChunkOffset(num_entries: usize, num_chunks: usize) usize {
+    return @sizeOf(Header) + num_entries * @sizeOf(Entry) + num_chunks * @sizeOf(Chunk);
+}
+
+// Compresses one chunk, falling back to storing it if LZ4 doesn't help. dst needs lz4.compressBound(src.len) bytes.
+pub fn compressChunk(src: []const u8, dst: []u8) usize {
+    const size = lz4.compress(src, dst);
+    if (size < src.len) return size;
+
+    @memcpy(dst[0..src.len], src);
+    return src.len;
+}
+
+// raw must be exactly the chunk's uncompressed size.
+pub fn decompressChunkData(src: []const u8, raw: []u8) lz4.DecompressError!void {
+    if (src.len == raw.len) {
+        @memcpy(raw, src);
+    } else if (try lz4.decompress(src, raw) != raw.len) {
+        return error.CorruptInput;
+    }
+}
+
+pub const Pack = struct {
+    bytes: []align(std.heap.page_size_min) const u8,
+    entries: []const Entry,
+    chunks: []const Chunk,
+
+    // Returns null if the pack is missing or doesn't match, so the caller can fall back to decoding PNGs.
+    // The mapping is read-only and shared, so every running game uses the same page cache pages.
+    pub fn open(dir: std.fs.Dir, sub_path: []const u8, num_entries: usize) ?Pack {
+        if (builtin.os.tag == .windows) return null;
+
+        const file = dir.openFile(sub_path, .{}) catch return null;
+        defer file.close();
+
+        const file_size = file.getEndPos() catch return null;
+        if (file_size < @sizeOf(Header)) return null;
+
+        const bytes = std.posix.mmap(
+            null,
+            file_size,
+            std.posix.PROT.READ,
+            .{ .TYPE = .SHARED },
+            file.handle,
+            0,
+        ) catch return null;
+
+        const header: *const Header = @ptrCast(bytes.ptr);
+
+        const valid_header = std.mem.eql(u8, &header.magic, &MAGIC) and
+            header.version == VERSION and
+            header.num_entries == num_entries and
+            file_size >= firstChunkOffset(num_entries, header.num_chunks);
+
+        if (!valid_header) {
+            std.posix.munmap(bytes);
+            return null;
+        }
+
+        const entries = @as([*]const Entry, @ptrCast(@alignCast(bytes.ptr + @sizeOf(Header))))[0..num_entries];
+        const chunks = @as([*]const Chunk, @ptrCast(@alignCast(bytes.ptr + @sizeOf(Header) + num_entries * @sizeOf(Entry))))[0..header.num_chunks];
+
+        const valid_index = for (entries) |entry| {
+            if (!validEntry(entry, chunks, file_size)) break false;
+        } else true;
+
+        if (!valid_index) {
+            std.posix.munmap(bytes);
+            return null;
+        }
+
+        return .{ .bytes = bytes, .entries = entries, .chunks = chunks };
+    }
+
+    fn validEntry(entry: Entry, chunks: []const Chunk, file_size: usize) bool {
+        if (!entry.isStored()) return entry.size == 0;
+        if (entry.palette_size > 256) return false;
+        if (entry.num_chunks != numChunks(entry.rawSize())) return false;
+        if (entry.first_chunk + entry.num_chunks > chunks.len or entry.offset + entry.size > file_size) return false;
+
+        var raw_size: usize = 0;
+
+        // Every chunk but the last is full, since chunks are found by their index alone.
+        for (chunks[entry.first_chunk..][0..entry.num_chunks], 1..) |chunk, chunk_number| {
+            const expected_size = if (chunk_number < entry.num_chunks) CHUNK_SIZE else chunk.raw_size;
+            if (chunk.offset + chunk.size > file_size or chunk.size > chunk.raw_size or chunk.raw_size != expected_size or chunk.raw_size > CHUNK_SIZE) return false;
+            raw_size += chunk.raw_size;
+        }
+
+        return raw_size == entry.rawSize();
+    }
+
+    pub fn close(self: Pack) void {
+        std.posix.munmap(self.bytes);
+    }
+
+    // Decompresses one chunk of an asset into its place in dst, which holds the asset's whole trimmed pixels.
+    pub fn decompressChunk(self: Pack, index: usize, chunk_index: usize, dst: []u8) lz4.DecompressError!void {
+        const entry = self.entries[index];
+        const chunk = self.chunks[entry.first_chunk + chunk_index];
+        const src = self.bytes[chunk.offset..][0..chunk.size];
+        const raw = dst[chunk_index * CHUNK_SIZE ..][0..chunk.raw_size];
+
+        try decompressChunkData(src, raw);
+    }
+};
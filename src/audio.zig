@@ -1,86 +1,825 @@
 /// Play sounds for the game.
+/// Every sound is converted to the device's format and ADPCM encoded at build time (see audio_assets.py and
+/// encode_audio.zig), and mixed by SDL's audio callback from a fixed pool of voices for sound effects, which play on
+/// top of the music as soon as they are started. Voices decode their sound a block at a time as they play.
+/// Music is too big to keep in memory, so it is streamed from disk instead, see MusicStream.
 const SDL = @import("sdl2");
 const std = @import("std");
 const utils = @import("utils.zig");
+const constants = @import("constants.zig");
+const Vec = @import("types.zig").Vec;
+const adpcm = @import("adpcm.zig");
 const audio_assets = @import("audio_assets.zig");
-const WavFile = @import("audio_assets.zig").WavFile;
+const EncodedSound = @import("audio_assets.zig").EncodedSound;
 
-// TODO: look into storing files zipped, and then decompressing at runtime.
+pub const FREQUENCY = 48000;
+pub const CHANNELS = 2;
+const FORMAT = SDL.AUDIO_S16SYS;
 
-// TODO: look into whether wavfile_slices can be const or not.
+// Latency of a sound effect is up to one device buffer: 1024 frames at 48 kHz is about 21 ms, 256 about 5 ms.
+// Smaller buffers give the callback less time to run, see AudioStats.underruns.
+pub const BUFFER_FRAMES: u16 = @import("build_options").audio_buffer_frames;
+const BUFFER_NS = @as(u64, BUFFER_FRAMES) * std.time.ns_per_s / FREQUENCY;
+
+// Voices are mixed in pieces of at most this many frames, whatever the device buffer size.
+pub const MIX_FRAMES = 1024;
+
+const NUM_SFX_VOICES = 15;
+
+// The build converts every asset to CHANNELS and FREQUENCY and encodes it, at the same path under this directory
+// but with an .adpcm extension, so nothing is converted at runtime. It is installed next to the executable.
+const ENCODED_AUDIO_DIR = "audio";
+
+const ENCODED_PATHS: [audio_assets.ALL.len][:0]const u8 = encoded_paths: {
+    var paths: [audio_assets.ALL.len][:0]const u8 = undefined;
+
+    for (&paths, audio_assets.ALL) |*encoded_path, audio_asset| {
+        encoded_path.* = ENCODED_AUDIO_DIR ++ "/" ++ audio_asset.path[0 .. audio_asset.path.len - ".wav".len] ++ ".adpcm";
+    }
+
+    break :encoded_paths paths;
+};
+
+pub const Frame = adpcm.Frame;
+pub const MixFrame = [CHANNELS]f32;
+
+// Samples per vector in the mixing kernels, a whole number of frames.
+const LANES = 16;
+
+pub const Voice = struct {
+    sound: adpcm.Sound = .{ .blocks = &.{}, .num_frames = 0 },
+    position: usize = 0,
+    gain: f32 = 1,
+    pan: f32 = 0, // From -1 (left only) to 1 (right only).
+    looping: bool = false,
+    handle: VoiceHandle = .none,
+    entity: ?u8 = null, // Pans with this dynamic entity, see AudioPlayer.followEntities.
+    decoded: [adpcm.BLOCK_FRAMES]Frame = undefined, // The block position is in.
+    decoded_block: ?usize = null,
+
+    pub fn isPlaying(self: Voice) bool {
+        return self.position < self.sound.num_frames;
+    }
+
+    fn remaining(self: Voice) usize {
+        return self.sound.num_frames - self.position;
+    }
+
+    // The frames from position to the end of its block, decoding the block if it wasn't yet.
+    fn decodedFrames(self: *Voice) []const Frame {
+        const block_index = self.position / adpcm.BLOCK_FRAMES;
+        const block_start = block_index * adpcm.BLOCK_FRAMES;
+
+        if (self.decoded_block != block_index) {
+            adpcm.decodeBlock(&self.sound.blocks[block_index], &self.decoded);
+            self.decoded_block = block_index;
+        }
+
+        return self.decoded[self.position - block_start .. @min(adpcm.BLOCK_FRAMES, self.sound.num_frames - block_start)];
+    }
+
+    // Adds the voice's next mix.len frames to mix, and advances it. gains come from channelGains.
+    pub fn mixInto(self: *Voice, mix: []MixFrame, gains: MixFrame) void {
+        var mixed: usize = 0;
+
+        while (mixed < mix.len and self.isPlaying()) {
+            const frames = self.decodedFrames();
+            const length = @min(mix.len - mixed, frames.len);
+
+            accumulateSamples(
+                std.mem.bytesAsSlice(f32, std.mem.sliceAsBytes(mix[mixed..][0..length])),
+                std.mem.bytesAsSlice(i16, std.mem.sliceAsBytes(frames[0..length])),
+                gains,
+            );
+
+            mixed += length;
+            self.position += length;
+
+            if (self.looping and !self.isPlaying()) self.position = 0;
+        }
+    }
+};
+
+// Left and right gains of up to LANES voices, in one vector operation instead of one per voice.
+// Balance rather than constant power panning, so a centred sound plays at its recorded level.
+pub fn channelGains(voices: []const Voice) [CHANNELS]@Vector(LANES, f32) {
+    const Gains = @Vector(LANES, f32);
+    const ONE: Gains = @splat(1);
+
+    var gain: Gains = @splat(0);
+    var pan: Gains = @splat(0);
+    for (voices[0..@min(voices.len, LANES)], 0..) |voice, i| {
+        gain[i] = voice.gain;
+        pan[i] = voice.pan;
+    }
+
+    return .{ gain * @min(ONE, ONE - pan), gain * @min(ONE, ONE + pan) };
+}
+
+// mix += samples * gains, on interleaved samples, LANES at a time.
+pub fn accumulateSamples(mix: []f32, samples: []const i16, gains: MixFrame) void {
+    const MixSamples = @Vector(LANES, f32);
+    const Samples = @Vector(LANES, i16);
+    const gain_lanes: MixSamples = std.simd.repeat(LANES, @as(@Vector(CHANNELS, f32), gains));
+
+    var i: usize = 0;
+    while (i + LANES <= mix.len) : (i += LANES) {
+        const chunk: Samples = samples[i..][0..LANES].*;
+        const accumulated: MixSamples = mix[i..][0..LANES].*;
+
+        mix[i..][0..LANES].* = @mulAdd(MixSamples, @floatFromInt(chunk), gain_lanes, accumulated);
+    }
+    while (i < mix.len) : (i += 1) {
+        mix[i] += @as(f32, @floatFromInt(samples[i])) * gains[i % CHANNELS];
+    }
+}
+
+// Converts the mix back to 16 bits, saturating anything too loud instead of letting it wrap around.
+pub fn saturateSamples(samples: []i16, mix: []const f32) void {
+    const MixSamples = @Vector(LANES, f32);
+    const Samples = @Vector(LANES, i16);
+    const MIN: MixSamples = @splat(std.math.minInt(i16));
+    const MAX: MixSamples = @splat(std.math.maxInt(i16));
+
+    var i: usize = 0;
+    while (i + LANES <= samples.len) : (i += LANES) {
+        const chunk: MixSamples = mix[i..][0..LANES].*;
+        samples[i..][0..LANES].* = @as(Samples, @intFromFloat(@min(@max(chunk, MIN), MAX)));
+    }
+    while (i < samples.len) : (i += 1) {
+        samples[i] = @intFromFloat(std.math.clamp(mix[i], std.math.minInt(i16), std.math.maxInt(i16)));
+    }
+}
+
+// Mixes every voice and the music into output, one whole piece of up to MIX_FRAMES per voice at a time.
+// Returns the number of frames the music was missing, because its reader fell behind.
+pub fn mixVoices(voices: []Voice, music: ?*MusicStream, mix_buffer: *[MIX_FRAMES]MixFrame, output: []Frame) usize {
+    var music_missing: usize = 0;
+    var start: usize = 0;
+    while (start < output.len) : (start += MIX_FRAMES) {
+        const output_piece = output[start..@min(output.len, start + MIX_FRAMES)];
+        const mix = mix_buffer[0..output_piece.len];
+
+        @memset(mix, .{ 0, 0 });
+
+        var first: usize = 0;
+        while (first < voices.len) : (first += LANES) {
+            const voice_group = voices[first..@min(voices.len, first + LANES)];
+            const left_gains, const right_gains = channelGains(voice_group);
+
+            for (voice_group, 0..) |*voice, i| {
+                if (voice.isPlaying()) voice.mixInto(mix, .{ left_gains[i], right_gains[i] });
+            }
+        }
+        if (music) |music_stream| {
+            music_missing += music_stream.mixInto(mix);
+        }
+
+        saturateSamples(
+            std.mem.bytesAsSlice(i16, std.mem.sliceAsBytes(output_piece)),
+            std.mem.bytesAsSlice(f32, std.mem.sliceAsBytes(mix)),
+        );
+    }
+
+    return music_missing;
+}
+
+// Music is read by the music thread (see AudioPlayer.readMusic), a chunk of blocks at a time, straight into a ring
+// buffer the audio callback decodes and plays from. Only about a second of the track is in memory at once, and the
+// game thread never waits for the file. The track loops until replaced, after the silence its last block is padded with.
+pub const MusicStream = struct {
+    const RING_BLOCKS = 192; // About a second.
+    const READ_BLOCKS = 64; // Reads wait for this much room, so they stay big.
+
+    ring: [RING_BLOCKS]adpcm.Block = undefined,
+    // Blocks ever written by the reader, and frames played by the callback. Each is only stored by its own thread.
+    written: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+    played: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+    gain: f32,
+    file: std.fs.File,
+    num_blocks: usize,
+    decoded: [adpcm.BLOCK_FRAMES]Frame = undefined, // Callback only.
+    decoded_block: ?usize = null,
+    blocks_left: usize = 0, // Music thread only. Until the end of the file, where reading starts over.
+
+    // Music thread only. Returns null, after logging why, if the file is missing or wasn't encoded by encode_audio.zig.
+    fn open(dir: std.fs.Dir, path: []const u8, gain: f32) ?*MusicStream {
+        const file = dir.openFile(path, .{}) catch |err| {
+            std.log.err("Can't open music file {s}: {s}", .{ path, @errorName(err) });
+            return null;
+        };
+
+        var header: adpcm.Header = undefined;
+        const valid = if (file.reader().readNoEof(std.mem.asBytes(&header))) |_|
+            std.mem.eql(u8, &header.magic, &adpcm.MAGIC) and header.frequency == FREQUENCY and header.num_frames > 0
+        else |_|
+            false;
+
+        if (!valid) {
+            std.log.err("Music file {s} wasn't encoded by encode_audio.zig.", .{path});
+            file.close();
+            return null;
+        }
+
+        const self = std.heap.c_allocator.create(MusicStream) catch unreachable;
+        self.* = .{ .gain = gain, .file = file, .num_blocks = adpcm.numBlocks(header.num_frames) };
+
+        return self;
+    }
+
+    // Only once the callback can't reach the stream anymore.
+    fn close(self: *MusicStream) void {
+        self.file.close();
+        std.heap.c_allocator.destroy(self);
+    }
+
+    // Music thread only. Reads a chunk if there is room for one, and returns whether it did.
+    fn fill(self: *MusicStream) bool {
+        const written = self.written.load(.monotonic);
+        // The block being played stays until all of it has been.
+        const free = RING_BLOCKS - (written - self.played.load(.acquire) / adpcm.BLOCK_FRAMES);
+
+        if (free < READ_BLOCKS) return false;
+
+        if (self.blocks_left == 0) {
+            self.file.seekTo(@sizeOf(adpcm.Header)) catch @panic("Can't read music file.");
+            self.blocks_left = self.num_blocks;
+        }
+
+        const ring_index = written % RING_BLOCKS;
+        const length = @min(free, RING_BLOCKS - ring_index, self.blocks_left);
+        const size = self.file.readAll(std.mem.sliceAsBytes(self.ring[ring_index..][0..length])) catch @panic("Can't read music file.");
+        const blocks_read = size / adpcm.BLOCK_SIZE;
+
+        // A file shorter than its header says just loops early.
+        self.blocks_left = if (blocks_read < length) 0 else self.blocks_left - blocks_read;
+        self.written.store(written + blocks_read, .release);
+
+        return true;
+    }
+
+    // Audio callback only. Returns the number of frames it didn't have yet.
+    fn mixInto(self: *MusicStream, mix: []MixFrame) usize {
+        const played = self.played.load(.monotonic);
+        const length = @min(mix.len, self.written.load(.acquire) * adpcm.BLOCK_FRAMES - played);
+        var mixed: usize = 0;
+
+        while (mixed < length) {
+            const block_index = (played + mixed) / adpcm.BLOCK_FRAMES;
+            const block_offset = (played + mixed) % adpcm.BLOCK_FRAMES;
+            const piece = @min(length - mixed, adpcm.BLOCK_FRAMES - block_offset);
+
+            if (self.decoded_block != block_index) {
+                adpcm.decodeBlock(&self.ring[block_index % RING_BLOCKS], &self.decoded);
+                self.decoded_block = block_index;
+            }
+
+            accumulateSamples(
+                std.mem.bytesAsSlice(f32, std.mem.sliceAsBytes(mix[mixed..][0..piece])),
+                std.mem.bytesAsSlice(i16, std.mem.sliceAsBytes(self.decoded[block_offset..][0..piece])),
+                .{ self.gain, self.gain },
+            );
+            mixed += piece;
+        }
+
+        self.played.store(played + length, .release);
+
+        // Before the first chunk arrives, the music just hasn't started yet.
+        return if (played + length == 0) 0 else mix.len - length;
+    }
+};
+
+// Identifies a sound started by AudioPlayer.playWith, to change or stop it later. Once the sound ends, or its voice is
+// taken by another sound, commands for it are ignored.
+pub const VoiceHandle = enum(u32) { none = 0, _ };
+
+// Sent from the game thread to the audio callback, which applies them before mixing.
+const Command = union(enum) {
+    play: struct { sound: adpcm.Sound, handle: VoiceHandle, gain: f32, pan: f32, entity: ?u8 },
+    stop: VoiceHandle,
+    set_gain: struct { handle: VoiceHandle, gain: f32 },
+    set_pan: struct { handle: VoiceHandle, pan: f32 },
+    entity_pans: [constants.VEC_LENGTH]f32,
+};
+
+const NUM_COMMANDS = 64; // Many more than a frame's worth, the callback drains them every few milliseconds.
+
+// Sent from the game thread to the music thread, which opens the file and hands the stream to the callback.
+const MusicRequest = union(enum) {
+    play: struct { path: [:0]const u8, gain: f32 },
+    stop,
+};
+
+const NUM_MUSIC_REQUESTS = 4;
+
+pub const AudioStats = struct {
+    buffer_frames: u16,
+    callbacks: u64,
+    underruns: u64, // Callbacks that came, or finished, too late for the device to play without a gap.
+    music_underruns: u64, // Callbacks that ran out of streamed music, because reading from disk fell behind.
+    max_callback_ns: u64,
+    mean_callback_ns: u64,
+    active_voices: u32, // Voices the last callback mixed.
+    max_active_voices: u32,
+    dropped_commands: u64, // Sent while the command queue was full.
+    queued_commands: u32, // Waiting in the command queue when the last callback started.
+    max_queued_commands: u32, // Out of NUM_COMMANDS. Close to it means commands are about to be dropped.
+};
+
+// Written by the audio callback only, and read from any thread.
+const Telemetry = struct {
+    callbacks: std.atomic.Value(u64) = std.atomic.Value(u64).init(0),
+    underruns: std.atomic.Value(u64) = std.atomic.Value(u64).init(0),
+    music_underruns: std.atomic.Value(u64) = std.atomic.Value(u64).init(0),
+    total_callback_ns: std.atomic.Value(u64) = std.atomic.Value(u64).init(0),
+    max_callback_ns: std.atomic.Value(u64) = std.atomic.Value(u64).init(0),
+    active_voices: std.atomic.Value(u32) = std.atomic.Value(u32).init(0),
+    max_active_voices: std.atomic.Value(u32) = std.atomic.Value(u32).init(0),
+    queued_commands: std.atomic.Value(u32) = std.atomic.Value(u32).init(0),
+    max_queued_commands: std.atomic.Value(u32) = std.atomic.Value(u32).init(0),
+    previous_start: ?std.time.Instant = null, // Only touched by the callback.
+
+    // SDL doesn't report underruns of callback driven devices. A callback that takes longer than the buffer it fills,
+    // or that starts more than half a buffer later than the one before it should have, left the device with nothing
+    // to play for a while.
+    fn record(
+        self: *Telemetry,
+        start: std.time.Instant,
+        end: std.time.Instant,
+        active_voices: u32,
+        queued_commands: u32,
+        music_missing: usize,
+    ) void {
+        const duration = end.since(start);
+        const late = if (self.previous_start) |previous_start| start.since(previous_start) > BUFFER_NS + BUFFER_NS / 2 else false;
+
+        self.previous_start = start;
+
+        _ = self.callbacks.fetchAdd(1, .monotonic);
+        _ = self.total_callback_ns.fetchAdd(duration, .monotonic);
+        _ = self.max_callback_ns.fetchMax(duration, .monotonic);
+        if (late or duration > BUFFER_NS) _ = self.underruns.fetchAdd(1, .monotonic);
+        if (music_missing > 0) _ = self.music_underruns.fetchAdd(1, .monotonic);
+
+        self.active_voices.store(active_voices, .monotonic);
+        _ = self.max_active_voices.fetchMax(active_voices, .monotonic);
+        self.queued_commands.store(queued_commands, .monotonic);
+        _ = self.max_queued_commands.fetchMax(queued_commands, .monotonic);
+    }
+
+    fn read(self: *const Telemetry) AudioStats {
+        const callbacks = self.callbacks.load(.monotonic);
+
+        return .{
+            .buffer_frames = BUFFER_FRAMES,
+            .callbacks = callbacks,
+            .underruns = self.underruns.load(.monotonic),
+            .music_underruns = self.music_underruns.load(.monotonic),
+            .max_callback_ns = self.max_callback_ns.load(.monotonic),
+            .mean_callback_ns = self.total_callback_ns.load(.monotonic) / @max(callbacks, 1),
+            .active_voices = self.active_voices.load(.monotonic),
+            .max_active_voices = self.max_active_voices.load(.monotonic),
+            .dropped_commands = 0, // Counted by the game thread.
+            .queued_commands = self.queued_commands.load(.monotonic),
+            .max_queued_commands = self.max_queued_commands.load(.monotonic),
+        };
+    }
+};
+
+// Voices and the music are only touched by the audio callback. The game thread never takes the audio device's lock,
+// and never touches a file: it sends commands to the callback through a lock free queue, and music requests to the
+// music thread through another. The music thread opens and reads the streams, hands them to the callback, and
+// closes them once the callback hands them back, replaced.
 pub const AudioPlayer = struct {
     device_id: SDL.SDL_AudioDeviceID = undefined,
 
     device_spec: SDL.SDL_AudioSpec = SDL.SDL_AudioSpec{
-        .freq = 48000,
-        .format = SDL.AUDIO_S16SYS,
-        .channels = 2,
+        .freq = FREQUENCY,
+        .format = FORMAT,
+        .channels = CHANNELS,
         .silence = 0,
-        .samples = 4096,
+        .samples = BUFFER_FRAMES,
         .padding = 0,
         .size = 0,
-        .callback = null,
+        .callback = &mixCallback,
         .userdata = null,
     },
 
-    var wav_files = utils.StaticMap(audio_assets.ID.size(), audio_assets.ID, []WavFile);
+    voices: [NUM_SFX_VOICES]Voice = .{Voice{}} ** NUM_SFX_VOICES,
+    music: ?*MusicStream = null,
+    mix_buffer: [MIX_FRAMES]MixFrame = undefined,
+    telemetry: Telemetry = .{},
+    commands: utils.SpscRing(Command, NUM_COMMANDS) = .{},
+    music_requests: utils.SpscRing(MusicRequest, NUM_MUSIC_REQUESTS) = .{},
+    music_swaps: utils.SpscRing(?*MusicStream, NUM_MUSIC_REQUESTS) = .{}, // null stops the music.
+    // Each swap the callback applies between two drains by the music thread replaces one stream, and there are at
+    // most a full queue of swaps waiting at a drain plus the requests handled after it.
+    replaced_music: utils.SpscRing(*MusicStream, 2 * NUM_MUSIC_REQUESTS) = .{},
+    music_thread: std.Thread = undefined,
+    quitting: std.atomic.Value(bool) = std.atomic.Value(bool).init(false),
+    entity_pans: [constants.VEC_LENGTH]f32 = .{0} ** constants.VEC_LENGTH, // Callback only.
+    // Game thread only.
+    next_handle: u32 = 1,
+    entity_steps_left: u64 = 0, // Game steps until every sound started by playAt has ended, and pans can stop.
+    paused: bool = false,
+    dropped_commands: u64 = 0,
+    asset_dir: ?std.fs.Dir = null, // Where the encoded sounds are installed, null if it can't be opened.
+
+    var encoded_sounds = utils.StaticMap(audio_assets.ID.size(), audio_assets.ID, []EncodedSound);
 
     pub fn init(self: *AudioPlayer) *AudioPlayer {
-        SDL.SDL_ClearError();
-        self.device_id = SDL.SDL_OpenAudioDevice(null, 0, &self.device_spec, &self.device_spec, SDL.SDL_AUDIO_ALLOW_ANY_CHANGE);
+        self.device_spec.userdata = self;
 
-        if (!std.mem.eql(u8, std.mem.span(SDL.SDL_GetError()), "")) {
+        // No changes allowed, SDL converts if the device wants another format, so the mixer always outputs FORMAT.
+        self.device_id = SDL.SDL_OpenAudioDevice(null, 0, &self.device_spec, &self.device_spec, 0);
+
+        if (self.device_id == 0) {
             utils.sdlPanic();
         }
 
-        // Load all audio assets.
+        self.asset_dir = utils.openExeDir() catch |err| dir: {
+            std.log.err("Can't find the directory of the executable, playing without sound: {s}", .{@errorName(err)});
+            break :dir null;
+        };
+
+        // Load all audio assets, except music which is streamed when played. Missing sounds just don't play.
         inline for (std.meta.fields(audio_assets.ID)) |enum_field| {
             const id: audio_assets.ID = @enumFromInt(enum_field.value);
+            if (comptime isMusic(id)) continue;
+
             var count: usize = 0;
 
-            // For simplicity, just check all visual assets.
-            for (audio_assets.ALL) |audio_asset| {
+            for (audio_assets.ALL, ENCODED_PATHS) |audio_asset, encoded_path| {
                 if (audio_asset.id != id) continue;
 
-                _ = SDL.SDL_LoadWAV(
-                    audio_asset.path,
-                    &self.device_spec,
-                    @as(?*(?*u8), @ptrCast(&audio_assets.wavfile_slices[id.int()][count].start_ptr)),
-                    &audio_assets.wavfile_slices[id.int()][count].length,
-                ) orelse utils.sdlPanic();
+                self.loadSound(encoded_path, &audio_assets.encoded_sound_slices[id.int()][count]);
 
                 count += 1;
 
-                if (count > audio_assets.wavfile_slices[id.int()].len) break;
+                if (count > audio_assets.encoded_sound_slices[id.int()].len) break;
             }
-            wav_files.insert(id, audio_assets.wavfile_slices[id.int()], false) catch unreachable;
+            encoded_sounds.insert(id, audio_assets.encoded_sound_slices[id.int()], false) catch unreachable;
         }
 
+        self.music_thread = std.Thread.spawn(.{}, readMusic, .{self}) catch unreachable;
+
+        // The callback mixes silence until a voice starts.
+        SDL.SDL_PauseAudioDevice(self.device_id, 0);
+
         return self;
     }
 
     pub fn deinit(self: *AudioPlayer) void {
-        for (wav_files.things) |wav_file_variations| {
-            for (wav_file_variations) |wav_file| {
-                SDL.SDL_FreeWAV(wav_file.start_ptr);
+        // Closing waits for the callback to return, so the sounds can be freed afterwards.
+        SDL.SDL_CloseAudioDevice(self.device_id);
+
+        self.quitting.store(true, .monotonic);
+        self.music_thread.join();
+
+        // Streams the callback never got to see, or never handed back.
+        while (self.music_swaps.pop()) |swap| {
+            if (swap) |music| music.close();
+        }
+        while (self.replaced_music.pop()) |music| {
+            music.close();
+        }
+
+        if (self.music) |music| {
+            music.close();
+        }
+
+        const audio_stats = self.stats();
+        std.debug.print("\nAudio: {d} frame buffers, {d} callbacks taking {d} us on average and {d} us at most, {d} underruns ({d} in music), up to {d} voices, up to {d}/{d} queued and {d} dropped commands.", .{
+            audio_stats.buffer_frames,
+            audio_stats.callbacks,
+            audio_stats.mean_callback_ns / std.time.ns_per_us,
+            audio_stats.max_callback_ns / std.time.ns_per_us,
+            audio_stats.underruns,
+            audio_stats.music_underruns,
+            audio_stats.max_active_voices,
+            audio_stats.max_queued_commands,
+            NUM_COMMANDS,
+            audio_stats.dropped_commands,
+        });
+
+        for (encoded_sounds.things[0..encoded_sounds.cur_front_idx]) |sound_variations| {
+            for (sound_variations) |encoded_sound| {
+                const start_ptr = encoded_sound.start_ptr orelse continue;
+                std.heap.c_allocator.free(@as([*]u8, @ptrCast(start_ptr))[0..encoded_sound.length]);
             }
         }
-        SDL.SDL_CloseAudioDevice(self.device_id);
+
+        if (self.asset_dir) |*asset_dir| asset_dir.close();
     }
 
+    // Sound effects stay encoded in memory, at about a quarter of their PCM size.
+    // A sound that can't be loaded is logged and left empty, so the game keeps running without it.
+    fn loadSound(self: *AudioPlayer, path: []const u8, encoded_sound: *EncodedSound) void {
+        encoded_sound.* = .{ .start_ptr = null, .length = 0 };
+
+        const asset_dir = self.asset_dir orelse return;
+        const bytes = asset_dir.readFileAlloc(std.heap.c_allocator, path, std.math.maxInt(u32)) catch |err| {
+            std.log.err("Can't read sound file {s}: {s}", .{ path, @errorName(err) });
+            return;
+        };
+
+        if (adpcm.Sound.fromBytes(bytes, FREQUENCY) == null) {
+            std.log.err("Sound file {s} wasn't encoded by encode_audio.zig.", .{path});
+            std.heap.c_allocator.free(bytes);
+            return;
+        }
+
+        encoded_sound.start_ptr = @ptrCast(bytes.ptr);
+        encoded_sound.length = @intCast(bytes.len);
+    }
+
+    // Music assets are the ones in a Music folder.
+    fn isMusic(comptime id: audio_assets.ID) bool {
+        return std.mem.indexOf(u8, @tagName(id), "_MUSIC_") != null;
+    }
+
+    fn pathOf(audio_asset_id: audio_assets.ID, sound_variation_index: usize) [:0]const u8 {
+        var count: usize = 0;
+
+        for (audio_assets.ALL, ENCODED_PATHS) |audio_asset, encoded_path| {
+            if (audio_asset.id != audio_asset_id) continue;
+            if (count == sound_variation_index) return encoded_path;
+            count += 1;
+        }
+        unreachable;
+    }
+
+    // Null if the sound couldn't be loaded.
+    fn soundOf(audio_asset_id: audio_assets.ID, sound_variation_index: usize) ?adpcm.Sound {
+        const encoded_sound = (encoded_sounds.lookup(audio_asset_id, false) catch unreachable)[sound_variation_index];
+        const bytes: [*]const u8 = @ptrCast(encoded_sound.start_ptr orelse return null);
+
+        return adpcm.Sound.fromBytes(bytes[0..encoded_sound.length], FREQUENCY).?;
+    }
+
+    // Plays a sound effect on top of whatever is playing. With every voice busy, the one closest to its end is cut off.
     pub fn play(self: *AudioPlayer, audio_asset_id: audio_assets.ID, sound_variation_index: usize) void {
-        const wav_file = (wav_files.lookup(audio_asset_id, false) catch unreachable)[sound_variation_index];
-        if (SDL.SDL_QueueAudio(
-            self.device_id,
-            wav_file.start_ptr,
-            wav_file.length,
-        ) != 0) {
-            utils.sdlPanic();
+        _ = self.playWith(audio_asset_id, sound_variation_index, 1, 0);
+    }
+
+    // None of these wait for the audio thread, the callback applies them before mixing its next buffer.
+    pub fn playWith(self: *AudioPlayer, audio_asset_id: audio_assets.ID, sound_variation_index: usize, gain: f32, pan: f32) VoiceHandle {
+        return self.start(audio_asset_id, sound_variation_index, gain, std.math.clamp(pan, -1, 1), null);
+    }
+
+    // Plays a sound that pans with a dynamic entity (an index into DynamicEntities) as it moves.
+    pub fn playAt(self: *AudioPlayer, audio_asset_id: audio_assets.ID, sound_variation_index: usize, gain: f32, entity: usize) VoiceHandle {
+        utils.assert(entity < constants.VEC_LENGTH, "playAt entity is not a dynamic entity index.");
+
+        const sound = soundOf(audio_asset_id, sound_variation_index) orelse return .none;
+        const sound_ns = @as(u64, sound.num_frames) * std.time.ns_per_s / FREQUENCY;
+        self.entity_steps_left = @max(self.entity_steps_left, sound_ns / constants.TIMESTEP_NS + 1);
+
+        return self.start(audio_asset_id, sound_variation_index, gain, 0, @intCast(entity));
+    }
+
+    // Once per frame, with the entities' horizontal positions in meters from the middle of the stage. Pans for all
+    // of them are computed at once and sent in a single command, so the cost doesn't grow with the number of sounds.
+    // Nothing is sent once the sounds started by playAt have all ended.
+    pub fn followEntities(self: *AudioPlayer, X: Vec) void {
+        if (self.paused) return; // Nothing drains the queue.
+        if (self.entity_steps_left == 0) return;
+        self.entity_steps_left -= 1;
+
+        const HALF_STAGE_WIDTH: Vec = @splat(constants.STAGE_WIDTH_METERS / 2);
+        self.send(.{ .entity_pans = @max(-constants.ONE_VEC, @min(constants.ONE_VEC, X / HALF_STAGE_WIDTH)) });
+    }
+
+    fn start(self: *AudioPlayer, audio_asset_id: audio_assets.ID, sound_variation_index: usize, gain: f32, pan: f32, entity: ?u8) VoiceHandle {
+        const sound = soundOf(audio_asset_id, sound_variation_index) orelse return .none;
+        const handle: VoiceHandle = @enumFromInt(self.next_handle);
+        self.next_handle +%= 1;
+        if (self.next_handle == 0) self.next_handle = 1;
+
+        self.send(.{ .play = .{
+            .sound = sound,
+            .handle = handle,
+            .gain = gain,
+            .pan = pan,
+            .entity = entity,
+        } });
+        self.unpause();
+
+        return handle;
+    }
+
+    pub fn stop(self: *AudioPlayer, handle: VoiceHandle) void {
+        self.send(.{ .stop = handle });
+    }
+
+    pub fn setGain(self: *AudioPlayer, handle: VoiceHandle, gain: f32) void {
+        self.send(.{ .set_gain = .{ .handle = handle, .gain = gain } });
+    }
+
+    pub fn setPan(self: *AudioPlayer, handle: VoiceHandle, pan: f32) void {
+        self.send(.{ .set_pan = .{ .handle = handle, .pan = std.math.clamp(pan, -1, 1) } });
+    }
+
+    // Replaces the current music, which loops until stopped. Returns right away, the music thread opens the file
+    // and the music starts once its first chunk has been read.
+    pub fn playMusic(self: *AudioPlayer, audio_asset_id: audio_assets.ID, sound_variation_index: usize, gain: f32) void {
+        self.requestMusic(.{ .play = .{ .path = pathOf(audio_asset_id, sound_variation_index), .gain = gain } });
+        self.unpause();
+    }
+
+    pub fn stopMusic(self: *AudioPlayer) void {
+        self.requestMusic(.stop);
+    }
+
+    fn requestMusic(self: *AudioPlayer, request: MusicRequest) void {
+        if (!self.music_requests.push(request)) self.dropped_commands += 1;
+    }
+
+    // A full queue means the audio thread is stalled, so dropping the command beats waiting for it.
+    fn send(self: *AudioPlayer, command: Command) void {
+        if (!self.commands.push(command)) self.dropped_commands += 1;
+    }
+
+    // Music thread. Opens the requested streams, keeps the newest one filled, and closes the ones the callback replaced.
+    fn readMusic(self: *AudioPlayer) void {
+        var reading: ?*MusicStream = null;
+
+        while (!self.quitting.load(.monotonic)) {
+            while (self.replaced_music.pop()) |music| {
+                music.close();
+            }
+
+            var busy = false;
+
+            // No more than a queue's worth at a time, which bounds the streams replaced before the next drain.
+            for (0..NUM_MUSIC_REQUESTS) |_| {
+                const request = self.music_requests.pop() orelse break;
+                busy = true;
+
+                // Music that can't be opened leaves the current music playing.
+                const music: ?*MusicStream = switch (request) {
+                    .play => |play| MusicStream.open(self.asset_dir orelse continue, play.path, play.gain) orelse continue,
+                    .stop => null,
+                };
+
+                // Holds as many swaps as there can be requests waiting, and the callback empties it every buffer.
+                if (!self.music_swaps.push(music)) {
+                    if (music) |unplayed| unplayed.close();
+                    continue;
+                }
+                reading = music;
+            }
+
+            if (reading) |music| {
+                if (music.fill()) busy = true;
+            }
+
+            if (!busy) std.time.sleep(10 * std.time.ns_per_ms);
         }
-        SDL.SDL_PauseAudioDevice(self.device_id, 0);
     }
 
     pub fn pause(self: *AudioPlayer) void {
         SDL.SDL_PauseAudioDevice(self.device_id, 1);
+        self.paused = true;
+    }
+
+    // Pausing and resuming take the device's lock, so only when it was paused.
+    fn unpause(self: *AudioPlayer) void {
+        if (!self.paused) return;
+
+        SDL.SDL_PauseAudioDevice(self.device_id, 0);
+        self.paused = false;
+    }
+
+    // Audio callback only.
+    fn applyCommands(self: *AudioPlayer) void {
+        while (self.commands.pop()) |command| {
+            switch (command) {
+                .play => |play_command| {
+                    var voice = &self.voices[0];
+
+                    for (&self.voices) |*candidate| {
+                        if (candidate.remaining() < voice.remaining()) voice = candidate;
+                    }
+
+                    voice.* = .{
+                        .sound = play_command.sound,
+                        .gain = play_command.gain,
+                        .pan = play_command.pan,
+                        .handle = play_command.handle,
+                        .entity = play_command.entity,
+                    };
+                },
+                .stop => |handle| if (self.voiceOf(handle)) |voice| {
+                    voice.position = voice.sound.num_frames;
+                    voice.looping = false;
+                },
+                .set_gain => |set_gain| if (self.voiceOf(set_gain.handle)) |voice| {
+                    voice.gain = set_gain.gain;
+                },
+                .set_pan => |set_pan| if (self.voiceOf(set_pan.handle)) |voice| {
+                    voice.pan = set_pan.pan;
+                },
+                .entity_pans => |entity_pans| self.entity_pans = entity_pans,
+            }
+        }
+
+        while (self.music_swaps.pop()) |music| {
+            if (self.music) |previous| {
+                utils.assert(self.replaced_music.push(previous), "Replaced music queue is full.");
+            }
+            self.music = music;
+        }
+
+        for (&self.voices) |*voice| {
+            if (voice.entity) |entity| voice.pan = self.entity_pans[entity];
+        }
+    }
+
+    fn voiceOf(self: *AudioPlayer, handle: VoiceHandle) ?*Voice {
+        for (&self.voices) |*voice| {
+            if (handle != .none and voice.handle == handle and voice.isPlaying()) return voice;
+        }
+        return null;
+    }
+
+    // Runs on SDL's audio thread, with the device locked.
+    fn mixCallback(userdata: ?*anyopaque, stream: [*c]u8, len: c_int) callconv(.C) void {
+        const self: *AudioPlayer = @ptrCast(@alignCast(userdata));
+        const output = @as([*]Frame, @ptrCast(@alignCast(stream)))[0 .. @as(usize, @intCast(len)) / @sizeOf(Frame)];
+
+        const start = std.time.Instant.now() catch unreachable;
+        const queued_commands: u32 = @intCast(self.commands.len());
+
+        self.applyCommands();
+
+        // The device may ask for more than MIX_FRAMES at once, which mixVoices splits up.
+        const music_missing = mixVoices(&self.voices, self.music, &self.mix_buffer, output);
+
+        var active_voices: u32 = 0;
+        for (self.voices) |voice| {
+            if (voice.isPlaying()) active_voices += 1;
+        }
+
+        self.telemetry.record(start, std.time.Instant.now() catch unreachable, active_voices, queued_commands, music_missing);
+    }
+
+    pub fn stats(self: *const AudioPlayer) AudioStats {
+        var audio_stats = self.telemetry.read();
+        audio_stats.dropped_commands = self.dropped_commands;
+        return audio_stats;
     }
 };
+
+test "Voice.mixInto pans, loops and stops" {
+    const frames = [_]Frame{ .{ 100, 100 }, .{ 200, 200 }, .{ 300, 300 } };
+
+    var bytes: [@sizeOf(adpcm.Header) + adpcm.BLOCK_SIZE]u8 align(@alignOf(adpcm.Header)) = undefined;
+    std.mem.bytesAsValue(adpcm.Header, bytes[0..@sizeOf(adpcm.Header)]).* = .{ .frequency = FREQUENCY, .num_frames = frames.len };
+    var encoder = adpcm.Encoder{};
+    encoder.encodeBlock(&frames, bytes[@sizeOf(adpcm.Header)..]);
+    const sound = adpcm.Sound.fromBytes(&bytes, FREQUENCY).?;
+
+    // ADPCM is lossy, so compare with what the block decodes to.
+    var decoded: [adpcm.BLOCK_FRAMES]Frame = undefined;
+    adpcm.decodeBlock(&sound.blocks[0], &decoded);
+    const samples = [3]f32{ @floatFromInt(decoded[0][0]), @floatFromInt(decoded[1][0]), @floatFromInt(decoded[2][0]) };
+
+    var mix: [4]MixFrame = .{.{ 0, 0 }} ** 4;
+
+    var voice = Voice{ .sound = sound, .gain = 0.5, .pan = 0.5 };
+    const left_gains, const right_gains = channelGains(&.{voice});
+    voice.mixInto(&mix, .{ left_gains[0], right_gains[0] });
+
+    try std.testing.expectEqualSlices(MixFrame, &.{
+        .{ samples[0] * 0.25, samples[0] * 0.5 },
+        .{ samples[1] * 0.25, samples[1] * 0.5 },
+        .{ samples[2] * 0.25, samples[2] * 0.5 },
+        .{ 0, 0 },
+    }, &mix);
+    try std.testing.expect(!voice.isPlaying());
+
+    var music = Voice{ .sound = sound, .looping = true };
+    mix = .{.{ 0, 0 }} ** 4;
+    music.mixInto(&mix, .{ 1, 1 });
+
+    try std.testing.expectEqualSlices(MixFrame, &.{
+        .{ samples[0], samples[0] },
+        .{ samples[1], samples[1] },
+        .{ samples[2], samples[2] },
+        .{ samples[0], samples[0] },
+    }, &mix);
+    try std.testing.expectEqual(1, music.position);
+}
+
+test "saturateSamples clamps instead of wrapping" {
+    var mix: [LANES + 3]f32 = undefined;
+    for (&mix, 0..) |*sample, i| sample.* = (@as(f32, @floatFromInt(i)) - 9) * 5000;
+
+    var samples: [mix.len]i16 = undefined;
+    saturateSamples(&samples, &mix);
+
+    for (samples, mix) |sample, mix_sample| {
+        try std.testing.expectEqual(@as(i16, @intFromFloat(std.math.clamp(mix_sample, -32768, 32767))), sample);
+    }
+}
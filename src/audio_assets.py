@@ -1,7 +1,14 @@
 # File to quickly generate zig code for array of all game audio assets, based on folder structure.
 # Similarly to how visual assets are handeled, but simpler.
+# Given a directory, also converts every asset there to the format the game mixes in, so it never converts at runtime.
 
-from os import path, scandir
+import struct
+import sys
+import wave
+from array import array
+from io import StringIO
+from multiprocessing import Pool
+from os import makedirs, path, scandir
 
 FILE_HEADER = (
     """\
@@ -12,7 +19,8 @@ const StaticMap = @import("utils.zig").StaticMap;
 const fields = @import("std").meta.fields;
 const print = @import("std").debug.print;
 
-pub const WavFile = struct {
+// An ADPCM encoded sound, as read from its file (see adpcm.zig).
+pub const EncodedSound = struct {
     start_ptr: ?*u8,
     length: u32,
 };
@@ -51,37 +59,162 @@ ASSETS_FOOTER = """\
 
 BACKING_INTEGER = "u16"
 
+# Must match FREQUENCY, CHANNELS and FORMAT (16 bit signed) in audio.zig.
+CANONICAL_RATE = 48000
+CANONICAL_CHANNELS = 2
+
+WAVE_FORMAT_PCM = 1
+WAVE_FORMAT_IEEE_FLOAT = 3
+WAVE_FORMAT_EXTENSIBLE = 0xFFFE
+
+
+# Returns the sample rate, channel count and samples (interleaved, scaled to 16 bits) of a PCM or float WAV file.
+def read_wav(wav_path):
+    with open(wav_path, "rb") as wav_file:
+        contents = wav_file.read()
+
+    if contents[0:4] != b"RIFF" or contents[8:12] != b"WAVE":
+        raise ValueError(wav_path + " is not a WAV file")
+
+    wav_format = None
+    offset = 12
+    while offset + 8 <= len(contents):
+        chunk_id = contents[offset : offset + 4]
+        (chunk_size,) = struct.unpack_from("<I", contents, offset + 4)
+        chunk = contents[offset + 8 : offset + 8 + chunk_size]
+
+        if chunk_id == b"fmt ":
+            tag, channels, rate, _, _, bits = struct.unpack_from("<HHIIHH", chunk)
+            # The actual tag starts the sub-format GUID.
+            if tag == WAVE_FORMAT_EXTENSIBLE and len(chunk) >= 26:
+                (tag,) = struct.unpack_from("<H", chunk, 24)
+            wav_format = (tag, channels, rate, bits)
+        elif chunk_id == b"data" and wav_format is not None:
+            tag, channels, rate, bits = wav_format
+            return rate, channels, decode_samples(chunk, tag, bits)
+
+        offset += 8 + chunk_size + chunk_size % 2
+
+    raise ValueError(wav_path + " has no samples")
+
+
+def decode_samples(data, tag, bits):
+    if tag == WAVE_FORMAT_IEEE_FLOAT and bits == 32:
+        floats = array("f", data[: len(data) - len(data) % 4])
+        if sys.byteorder == "big":
+            floats.byteswap()
+        return array("h", (max(-32768, min(32767, round(sample * 32767))) for sample in floats))
+
+    if tag != WAVE_FORMAT_PCM:
+        raise ValueError("unsupported WAV format " + str(tag))
+
+    if bits == 8:
+        return array("h", ((sample - 128) << 8 for sample in data))
+    if bits == 16:
+        samples = array("h", data[: len(data) - len(data) % 2])
+        if sys.byteorder == "big":
+            samples.byteswap()
+        return samples
+    if bits in (24, 32):
+        size = bits // 8
+        return array(
+            "h",
+            (int.from_bytes(data[i : i + size], "little", signed=True) >> (bits - 16) for i in range(0, len(data) - size + 1, size)),
+        )
+
+    raise ValueError("unsupported WAV sample size " + str(bits))
+
+
+# Mono is played on both sides, anything above stereo keeps its front left and right channels.
+def to_stereo(samples, channels):
+    if channels == CANONICAL_CHANNELS:
+        return samples
+
+    stereo = array("h", bytes(len(samples) // channels * 2 * CANONICAL_CHANNELS))
+    for channel in range(CANONICAL_CHANNELS):
+        stereo[channel::CANONICAL_CHANNELS] = samples[min(channel, channels - 1) :: channels]
+    return stereo
+
+
+# Linear interpolation. Good enough for the game's sounds, and only runs when an asset changes.
+def resample(samples, rate):
+    if rate == CANONICAL_RATE:
+        return samples
+
+    num_frames = len(samples) // CANONICAL_CHANNELS
+    num_resampled_frames = num_frames * CANONICAL_RATE // rate
+    resampled = array("h", bytes(num_resampled_frames * 2 * CANONICAL_CHANNELS))
+
+    for channel in range(CANONICAL_CHANNELS):
+        channel_samples = samples[channel::CANONICAL_CHANNELS]
+        for frame in range(num_resampled_frames):
+            position = frame * rate / CANONICAL_RATE
+            index = int(position)
+            next_index = min(index + 1, num_frames - 1)
+            weight = position - index
+            resampled[frame * CANONICAL_CHANNELS + channel] = round(
+                channel_samples[index] + (channel_samples[next_index] - channel_samples[index]) * weight
+            )
+
+    return resampled
+
+
+# Writes the asset at the same relative path under output_dir, as 48 kHz stereo 16 bit PCM.
+def convert_wav(wav_path, output_dir):
+    rate, channels, samples = read_wav(wav_path)
+    samples = resample(to_stereo(samples, channels), rate)
+    if sys.byteorder == "big":
+        samples.byteswap()
+
+    output_path = path.join(output_dir, wav_path)
+    makedirs(path.dirname(output_path), exist_ok=True)
+
+    with wave.open(output_path, "wb") as output:
+        output.setnchannels(CANONICAL_CHANNELS)
+        output.setsampwidth(2)
+        output.setframerate(CANONICAL_RATE)
+        output.writeframes(samples.tobytes())
+
+
+# Directory order differs between file systems, so entries are sorted to make the output depend on the assets alone.
+def sorted_scandir(directory):
+    return sorted(scandir(directory), key=lambda entry: entry.name)
+
+
 # Run this file from the project root (i.e. the battlebuds/ directory).
-# Update: script is automatically called from build.zig now.
+# Update: script is automatically called from build.zig now, with the output path and converted asset directory as
+# arguments, and only re-run when an asset changes.
 if __name__ == "__main__":
     print("\nRUNNING:", __file__, "\n")
     TAB_SIZE = 4
     asset_dir = "assets/audio"
-    output_file = "src/audio_assets.zig"
+    output_file = sys.argv[1] if len(sys.argv) > 1 else "src/audio_assets.zig"
+    converted_dir = sys.argv[2] if len(sys.argv) > 2 else None
+    wav_paths = []
 
-    with open(output_file, "w") as outfile:
+    with StringIO() as outfile:
         print(FILE_HEADER, file=outfile)
 
         enum_string = ENUM_HEADER
         assets_string = ""
         audio_assets_per_id = []
-        wavfile_array_names = []
+        encoded_sound_array_names = []
 
         total_num_assets = 0
-        for asset_type_dir in scandir(asset_dir):
+        for asset_type_dir in sorted_scandir(asset_dir):
             if not asset_type_dir.is_dir():
                 continue
 
             asset_type = asset_type_dir.name
 
-            for asset_subtype_dir in scandir(asset_type_dir.path):
+            for asset_subtype_dir in sorted_scandir(asset_type_dir.path):
                 if not asset_subtype_dir.is_dir():
                     continue
 
                 asset_subtype = asset_subtype_dir.name
 
                 has_sounds = False
-                for sound_dir in scandir(asset_subtype_dir.path):
+                for sound_dir in sorted_scandir(asset_subtype_dir.path):
                     if not sound_dir.is_dir():
                         continue
 
@@ -105,6 +238,7 @@ if __name__ == "__main__":
                             continue
 
                         num_assets += 1
+                        wav_paths.append(path.relpath(sound_variation.path, "."))
                         assets_string += (
                             '\t.{ .path = "'
                             + path.relpath(sound_variation.path, ".")
@@ -116,7 +250,7 @@ if __name__ == "__main__":
                     if num_assets > 0:
                         enum_string += "\t" + id + ",\n"
                         audio_assets_per_id.append(num_assets)
-                        wavfile_array_names.append(id.lower() + "_wavfiles")
+                        encoded_sound_array_names.append(id.lower() + "_encoded_sounds")
                         total_num_assets += num_assets
 
         enum_string += ENUM_FOOTER
@@ -138,14 +272,21 @@ if __name__ == "__main__":
         )
         print(audio_assets_per_id_string.expandtabs(TAB_SIZE), file=outfile)
 
-        print("// Storage for .wav files to be initialized at runtime.", file=outfile)
-        for size, array_name in zip(audio_assets_per_id, wavfile_array_names):
+        print("// Storage for the encoded sounds, loaded at runtime.", file=outfile)
+        for size, array_name in zip(audio_assets_per_id, encoded_sound_array_names):
             print(
-                "var " + array_name + ": [" + str(size) + "]WavFile = undefined;",
+                "var " + array_name + ": [" + str(size) + "]EncodedSound = undefined;",
                 file=outfile,
             )
 
-        print("\npub var wavfile_slices: [ID.size()][]WavFile = .{", file=outfile)
-        for array_name in wavfile_array_names:
+        print("\npub var encoded_sound_slices: [ID.size()][]EncodedSound = .{", file=outfile)
+        for array_name in encoded_sound_array_names:
             print(("\t&" + array_name + ",").expandtabs(TAB_SIZE), file=outfile)
         print("};", file=outfile)
+
+        with open(output_file, "w") as output:
+            output.write(outfile.getvalue())
+
+    if converted_dir is not None:
+        with Pool() as pool:
+            pool.starmap(convert_wav, [(wav_path, converted_dir) for wav_path in wav_paths])
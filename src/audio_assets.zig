@@ -3,7 +3,8 @@ const StaticMap = @import("utils.zig").StaticMap;
 const fields = @import("std").meta.fields;
 const print = @import("std").debug.print;
 
-pub const WavFile = struct {
+// An ADPCM encoded sound, as read from its file (see adpcm.zig).
+pub const EncodedSound = struct {
     start_ptr: ?*u8,
     length: u32,
 };
@@ -14,6 +15,8 @@ pub const AudioAsset = struct {
 };
 
 pub const ID = enum(u16) {
+    GAME_EFFECTS_HIT,
+    GAME_EFFECTS_SHOT,
     MENU_MUSIC_TRACK1,
 
     pub inline fn int(comptime id: ID) u16 {
@@ -25,15 +28,21 @@ pub const ID = enum(u16) {
     }
 };
 
-pub const ALL: [1]AudioAsset = .{
+pub const ALL: [3]AudioAsset = .{
+    .{ .path = "assets/audio/Game/Effects/Hit/1.wav", .id = .GAME_EFFECTS_HIT },
+    .{ .path = "assets/audio/Game/Effects/Shot/1.wav", .id = .GAME_EFFECTS_SHOT },
     .{ .path = "assets/audio/Menu/Music/Track1/1.wav", .id = .MENU_MUSIC_TRACK1 },
 };
 
-pub const ASSETS_PER_ID: [ID.size()]usize = .{ 1 };
+pub const ASSETS_PER_ID: [ID.size()]usize = .{ 1, 1, 1 };
 
-// Storage for .wav files to be initialized at runtime.
-var menu_music_track1_wavfiles: [1]WavFile = undefined;
+// Storage for the encoded sounds, loaded at runtime.
+var game_effects_hit_encoded_sounds: [1]EncodedSound = undefined;
+var game_effects_shot_encoded_sounds: [1]EncodedSound = undefined;
+var menu_music_track1_encoded_sounds: [1]EncodedSound = undefined;
 
-pub var wavfile_slices: [ID.size()][]WavFile = .{
-    &menu_music_track1_wavfiles,
+pub var encoded_sound_slices: [ID.size()][]EncodedSound = .{
+    &game_effects_hit_encoded_sounds,
+    &game_effects_shot_encoded_sounds,
+    &menu_music_track1_encoded_sounds,
 };
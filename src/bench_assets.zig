@@ -0,0 +1,88 @@
+/// Benchmark, run with `zig build bench`. Decodes every PNG the way the game used to at startup,
+/// then compresses and decompresses the same pixels in LZ4 chunks, the way the asset pack stores them.
+/// Single-threaded throughputs, in MB of uncompressed pixels per second. Also times the copy from the decompressed
+/// pixels into an upload buffer, which the game pays for on top of decompressing.
+const std = @import("std");
+
+const visual_assets = @import("visual_assets.zig");
+const asset_pack = @import("asset_pack.zig");
+const pack_assets = @import("pack_assets.zig");
+const lz4 = @import("lz4.zig");
+
+pub fn main() !void {
+    var png_decode_ns: u64 = 0;
+    var compress_ns: u64 = 0;
+    var decompress_ns: u64 = 0;
+    var copy_ns: u64 = 0;
+    var raw_size: usize = 0;
+    var compressed_size: usize = 0;
+
+    for (visual_assets.ALL) |asset| {
+        var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+        defer arena.deinit();
+
+        var timer = try std.time.Timer.start();
+
+        const pixels = try pack_assets.decodeTrimmedPixels(asset, &arena);
+        png_decode_ns += timer.lap();
+
+        const num_chunks = asset_pack.numChunks(pixels.len);
+        const compressed = try arena.allocator().alloc(u8, num_chunks * lz4.compressBound(asset_pack.CHUNK_SIZE));
+        const chunk_sizes = try arena.allocator().alloc(usize, num_chunks);
+        const decompressed = try arena.allocator().alloc(u8, pixels.len);
+        const upload = try arena.allocator().alloc(u8, pixels.len);
+
+        _ = timer.lap();
+
+        var compressed_end: usize = 0;
+        for (chunk_sizes, 0..) |*chunk_size, chunk_index| {
+            chunk_size.* = asset_pack.compressChunk(rawChunk(pixels, chunk_index), compressed[compressed_end..]);
+            compressed_end += chunk_size.*;
+        }
+        compress_ns += timer.lap();
+
+        var compressed_start: usize = 0;
+        for (chunk_sizes, 0..) |chunk_size, chunk_index| {
+            try asset_pack.decompressChunkData(compressed[compressed_start..][0..chunk_size], rawChunk(decompressed, chunk_index));
+            compressed_start += chunk_size;
+        }
+        decompress_ns += timer.lap();
+
+        // What loadTexture does with the decompressed pixels, into the locked texture.
+        @memcpy(upload, decompressed);
+        copy_ns += timer.lap();
+
+        if (!std.mem.eql(u8, pixels, upload)) return error.RoundTripMismatch;
+
+        raw_size += pixels.len;
+        compressed_size += compressed_end;
+    }
+
+    std.debug.print(
+        \\
+        \\{d} assets, {d} MB of trimmed RGBA pixels.
+        \\PNG decode:      {d:>8.1} MB/s
+        \\LZ4 compress:    {d:>8.1} MB/s, {d:.1}% of raw size
+        \\LZ4 decompress:  {d:>8.1} MB/s
+        \\Upload copy:     {d:>8.1} MB/s, {d:.1}% on top of decompressing
+        \\
+    , .{
+        visual_assets.ALL.len,
+        raw_size >> 20,
+        megabytesPerSecond(raw_size, png_decode_ns),
+        megabytesPerSecond(raw_size, compress_ns),
+        100 * @as(f64, @floatFromInt(compressed_size)) / @as(f64, @floatFromInt(raw_size)),
+        megabytesPerSecond(raw_size, decompress_ns),
+        megabytesPerSecond(raw_size, copy_ns),
+        100 * @as(f64, @floatFromInt(copy_ns)) / @as(f64, @floatFromInt(@max(decompress_ns, 1))),
+    });
+}
+
+fn rawChunk(pixels: []u8, chunk_index: usize) []u8 {
+    const start = chunk_index * asset_pack.CHUNK_SIZE;
+    return pixels[start..][0..@min(pixels.len - start, asset_pack.CHUNK_SIZE)];
+}
+
+fn megabytesPerSecond(size: usize, ns: u64) f64 {
+    return @as(f64, @floatFromInt(size)) / (1 << 20) / (@as(f64, @floatFromInt(@max(ns, 1))) / std.time.ns_per_s);
+}
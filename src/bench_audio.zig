@@ -0,0 +1,134 @@
+/// Benchmark, run with `zig build bench`. Mixes device buffers of many looping voices, with the vectorised kernels
+/// the audio callback uses and with a plain per-sample loop over PCM, in voices mixed per millisecond (one voice mixed
+/// is one device buffer of it), and how much of the audio thread's time 32 voices take. Also times ADPCM decoding on
+/// its own, which the callback's voices pay for, and how much smaller it makes sounds.
+const std = @import("std");
+
+const adpcm = @import("adpcm.zig");
+const audio = @import("audio.zig");
+
+const NUM_VOICES = 32;
+const NUM_BUFFERS = 2000;
+const SOUND_FRAMES = audio.FREQUENCY; // One second, so voices wrap around while being mixed.
+
+pub fn main() !void {
+    const sound = try std.heap.page_allocator.alloc(audio.Frame, SOUND_FRAMES);
+    defer std.heap.page_allocator.free(sound);
+
+    var prng = std.Random.DefaultPrng.init(0);
+    for (sound) |*frame| {
+        frame.* = .{ prng.random().int(i16), prng.random().int(i16) };
+    }
+
+    const blocks = try std.heap.page_allocator.alloc(adpcm.Block, adpcm.numBlocks(SOUND_FRAMES));
+    defer std.heap.page_allocator.free(blocks);
+
+    var encoder = adpcm.Encoder{};
+    for (blocks, 0..) |*block, block_index| {
+        const start = block_index * adpcm.BLOCK_FRAMES;
+        encoder.encodeBlock(sound[start..@min(sound.len, start + adpcm.BLOCK_FRAMES)], block);
+    }
+
+    var voices: [NUM_VOICES]audio.Voice = undefined;
+    var positions: [NUM_VOICES]usize = undefined;
+    for (&voices, &positions, 0..) |*voice, *position, i| {
+        const pan = @as(f32, @floatFromInt(i)) / NUM_VOICES * 2 - 1;
+        position.* = i * 997;
+        voice.* = .{
+            .sound = .{ .blocks = blocks, .num_frames = SOUND_FRAMES },
+            .position = position.*,
+            .gain = 0.1,
+            .pan = pan,
+            .looping = true,
+        };
+    }
+
+    var mix_buffer: [audio.MIX_FRAMES]audio.MixFrame = undefined;
+    var output: [audio.MIX_FRAMES]audio.Frame = undefined;
+    var checksum: i64 = 0;
+
+    var timer = try std.time.Timer.start();
+
+    for (0..NUM_BUFFERS) |_| {
+        _ = audio.mixVoices(&voices, null, &mix_buffer, &output);
+        checksum +%= output[output.len / 2][0];
+    }
+    const vector_ns = timer.lap();
+
+    for (0..NUM_BUFFERS) |_| {
+        mixScalar(&voices, &positions, sound, &mix_buffer, &output);
+        checksum +%= output[output.len / 2][0];
+    }
+    const scalar_ns = timer.lap();
+
+    var decoded: [adpcm.BLOCK_FRAMES]audio.Frame = undefined;
+    const decoded_blocks = NUM_BUFFERS * audio.MIX_FRAMES / adpcm.BLOCK_FRAMES;
+
+    timer.reset();
+    for (0..decoded_blocks) |i| {
+        adpcm.decodeBlock(&blocks[i % blocks.len], &decoded);
+        checksum +%= decoded[i % adpcm.BLOCK_FRAMES][0];
+    }
+    const decode_ns = timer.lap();
+
+    const pcm_size = SOUND_FRAMES * @sizeOf(audio.Frame);
+    const adpcm_size = @sizeOf(adpcm.Header) + blocks.len * adpcm.BLOCK_SIZE;
+
+    const buffer_ns = audio.MIX_FRAMES * std.time.ns_per_s / audio.FREQUENCY;
+
+    std.debug.print(
+        \\
+        \\{d} voices, {d} buffers of {d} frames (checksum {d}).
+        \\Vector mix:  {d:>10.1} voices/ms, {d:.2}% of the audio thread (ADPCM)
+        \\Scalar mix:  {d:>10.1} voices/ms, {d:.2}% of the audio thread (PCM)
+        \\ADPCM decode: {d:>9.0} ns per voice per buffer, {d:.2}x smaller than PCM
+        \\
+    , .{
+        NUM_VOICES,
+        NUM_BUFFERS,
+        audio.MIX_FRAMES,
+        checksum,
+        voicesPerMillisecond(vector_ns),
+        100 * nsPerBuffer(vector_ns) / buffer_ns,
+        voicesPerMillisecond(scalar_ns),
+        100 * nsPerBuffer(scalar_ns) / buffer_ns,
+        @as(f64, @floatFromInt(decode_ns)) / NUM_BUFFERS,
+        @as(f64, pcm_size) / @as(f64, @floatFromInt(adpcm_size)),
+    });
+}
+
+// The mixer before it was vectorised and sounds were encoded, as a reference.
+fn mixScalar(
+    voices: []const audio.Voice,
+    positions: []usize,
+    frames: []const audio.Frame,
+    mix: *[audio.MIX_FRAMES]audio.MixFrame,
+    output: []audio.Frame,
+) void {
+    @memset(mix, .{ 0, 0 });
+
+    for (voices, positions) |voice, *position| {
+        const gains = audio.MixFrame{ voice.gain * @min(1, 1 - voice.pan), voice.gain * @min(1, 1 + voice.pan) };
+
+        for (mix) |*mix_frame| {
+            inline for (mix_frame, frames[position.*], gains) |*mix_sample, sample, gain| {
+                mix_sample.* += @as(f32, @floatFromInt(sample)) * gain;
+            }
+            position.* = (position.* + 1) % frames.len;
+        }
+    }
+
+    for (output, mix) |*frame, mix_frame| {
+        inline for (frame, mix_frame) |*sample, mix_sample| {
+            sample.* = @intFromFloat(std.math.clamp(mix_sample, -32768, 32767));
+        }
+    }
+}
+
+fn nsPerBuffer(ns: u64) f64 {
+    return @as(f64, @floatFromInt(ns)) / NUM_BUFFERS;
+}
+
+fn voicesPerMillisecond(ns: u64) f64 {
+    return NUM_VOICES * NUM_BUFFERS / (@as(f64, @floatFromInt(@max(ns, 1))) / std.time.ns_per_ms);
+}
@@ -0,0 +1,105 @@
+/// Benchmark, run with `zig build bench`. Composites full frames of a fight (an opaque stage background and
+/// translucent sprites all over it) with the software renderer's tiled compositor, on 1 worker and then on twice as
+/// many each time up to one per core, in ms per frame and speedup over a single worker.
+const std = @import("std");
+
+const constants = @import("constants.zig");
+const software_render = @import("software_render.zig");
+
+const WIDTH = constants.X_RESOLUTION;
+const HEIGHT = constants.Y_RESOLUTION;
+const Compositor = software_render.TiledCompositor(WIDTH, HEIGHT);
+
+const NUM_SPRITES = 64;
+const SPRITE_SIZE = 256;
+const NUM_FRAMES = 200;
+
+pub fn main() !void {
+    const allocator = std.heap.page_allocator;
+
+    var prng = std.Random.DefaultPrng.init(0);
+    const random = prng.random();
+
+    const background_pixels = try allocator.alloc(u32, WIDTH * HEIGHT);
+    defer allocator.free(background_pixels);
+    const sprite_pixels = try allocator.alloc(u32, SPRITE_SIZE * SPRITE_SIZE);
+    defer allocator.free(sprite_pixels);
+
+    for (background_pixels) |*pixel| pixel.* = random.int(u32) | 0xFF000000;
+
+    // Mostly transparent around the character, like the sprites are.
+    for (sprite_pixels, 0..) |*pixel, i| {
+        const x = i % SPRITE_SIZE;
+        const y = i / SPRITE_SIZE;
+        const inside = x > SPRITE_SIZE / 4 and x < SPRITE_SIZE * 3 / 4 and y > SPRITE_SIZE / 8;
+
+        pixel.* = if (inside) random.int(u32) | 0x80000000 else 0;
+    }
+
+    const background = software_render.Image{ .pixels = .{ .rgba = background_pixels.ptr }, .width = WIDTH, .height = HEIGHT, .is_opaque = true };
+    const sprite = software_render.Image{ .pixels = .{ .rgba = sprite_pixels.ptr }, .width = SPRITE_SIZE, .height = SPRITE_SIZE, .is_opaque = false };
+
+    var positions: [NUM_SPRITES][2]i32 = undefined;
+    for (&positions) |*position| {
+        position.* = .{ random.intRangeLessThan(i32, -SPRITE_SIZE / 2, WIDTH), random.intRangeLessThan(i32, -SPRITE_SIZE / 2, HEIGHT) };
+    }
+
+    const target = software_render.Surface.init(allocator, WIDTH, HEIGHT);
+    defer target.deinit(allocator);
+
+    const compositor = try allocator.create(Compositor);
+    defer allocator.destroy(compositor);
+
+    compositor.* = .{};
+    compositor.init(allocator);
+    defer compositor.deinit();
+
+    const max_workers = compositor.num_workers;
+    var single_worker_ns: u64 = 0;
+
+    std.debug.print("\n{d} sprites of {d}x{d} over a {d}x{d} background, {d} frames:\n", .{
+        NUM_SPRITES,
+        SPRITE_SIZE,
+        SPRITE_SIZE,
+        WIDTH,
+        HEIGHT,
+        NUM_FRAMES,
+    });
+
+    var num_workers: usize = 1;
+    while (true) : (num_workers = @min(num_workers * 2, max_workers)) {
+        // The pool was sized for max_workers, fewer workers just leave some of its threads idle.
+        compositor.num_workers = num_workers;
+
+        var timer = try std.time.Timer.start();
+
+        for (0..NUM_FRAMES) |_| {
+            // Every tile is redrawn, as in a fight where everything moves.
+            compositor.invalidate();
+            compositor.push(target, background, 0, 0);
+
+            for (positions) |position| {
+                compositor.push(target, sprite, position[0], position[1]);
+            }
+            compositor.flush(target);
+        }
+
+        const ns = timer.read();
+        if (num_workers == 1) single_worker_ns = ns;
+
+        std.debug.print("  {d:>2} workers: {d:>7.3} ms per frame, {d:.2}x ({d:.0}% of linear)\n", .{
+            num_workers,
+            @as(f64, @floatFromInt(ns)) / NUM_FRAMES / std.time.ns_per_ms,
+            speedup(single_worker_ns, ns),
+            100 * speedup(single_worker_ns, ns) / @as(f64, @floatFromInt(num_workers)),
+        });
+
+        if (num_workers == max_workers) break;
+    }
+
+    std.debug.print("(checksum {d})\n", .{target.pixels[target.pixels.len / 2]});
+}
+
+fn speedup(single_worker_ns: u64, ns: u64) f64 {
+    return @as(f64, @floatFromInt(single_worker_ns)) / @as(f64, @floatFromInt(@max(ns, 1)));
+}
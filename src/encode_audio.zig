@@ -0,0 +1,116 @@
+/// Build-time tool: encodes every WAV under the input directory (already converted to 48 kHz stereo 16 bit PCM by
+/// audio_assets.py) to ADPCM, at the same relative path under the output directory, with an .adpcm extension.
+/// Usage: encode_audio <input directory> <output directory>.
+const std = @import("std");
+
+const adpcm = @import("adpcm.zig");
+
+const FREQUENCY = 48000;
+
+pub fn main() !void {
+    var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena.deinit();
+
+    const args = try std.process.argsAlloc(arena.allocator());
+    if (args.len != 3) {
+        std.debug.print("Usage: {s} <input directory> <output directory>\n", .{args[0]});
+        return error.InvalidArguments;
+    }
+
+    var input_dir = try std.fs.cwd().openDir(args[1], .{ .iterate = true });
+    defer input_dir.close();
+
+    var output_dir = try std.fs.cwd().makeOpenPath(args[2], .{});
+    defer output_dir.close();
+
+    var pool: std.Thread.Pool = undefined;
+    try pool.init(.{ .allocator = arena.allocator() });
+    defer pool.deinit();
+
+    var wait_group: std.Thread.WaitGroup = .{};
+    var failed = std.atomic.Value(bool).init(false);
+
+    var walker = try input_dir.walk(arena.allocator());
+    defer walker.deinit();
+
+    while (try walker.next()) |entry| {
+        if (entry.kind != .file or !std.mem.endsWith(u8, entry.basename, ".wav")) continue;
+
+        // The walker reuses its path buffer.
+        const path = try arena.allocator().dupe(u8, entry.path);
+        pool.spawnWg(&wait_group, encodeFile, .{ input_dir, output_dir, path, &failed });
+    }
+    pool.waitAndWork(&wait_group);
+
+    if (failed.load(.acquire)) return error.EncodingFailed;
+}
+
+fn encodeFile(input_dir: std.fs.Dir, output_dir: std.fs.Dir, path: []const u8, failed: *std.atomic.Value(bool)) void {
+    encode(input_dir, output_dir, path) catch |err| {
+        std.debug.print("\nFailed to encode {s}: {s}", .{ path, @errorName(err) });
+        failed.store(true, .release);
+    };
+}
+
+fn encode(input_dir: std.fs.Dir, output_dir: std.fs.Dir, path: []const u8) !void {
+    var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena.deinit();
+
+    const wav = try input_dir.readFileAllocOptions(arena.allocator(), path, std.math.maxInt(u32), null, @alignOf(adpcm.Frame), null);
+    const frames = try pcmFrames(wav);
+
+    const encoded = try arena.allocator().alloc(u8, @sizeOf(adpcm.Header) + adpcm.numBlocks(frames.len) * adpcm.BLOCK_SIZE);
+    const header = adpcm.Header{ .frequency = FREQUENCY, .num_frames = @intCast(frames.len) };
+    @memcpy(encoded[0..@sizeOf(adpcm.Header)], std.mem.asBytes(&header));
+
+    const blocks: [*]adpcm.Block = @ptrCast(encoded[@sizeOf(adpcm.Header)..].ptr);
+    var encoder = adpcm.Encoder{};
+
+    for (0..adpcm.numBlocks(frames.len)) |block_index| {
+        const start = block_index * adpcm.BLOCK_FRAMES;
+        encoder.encodeBlock(frames[start..@min(frames.len, start + adpcm.BLOCK_FRAMES)], &blocks[block_index]);
+    }
+
+    const output_path = try std.mem.concat(arena.allocator(), u8, &.{ path[0 .. path.len - ".wav".len], ".adpcm" });
+    if (std.fs.path.dirname(output_path)) |output_subdir| {
+        try output_dir.makePath(output_subdir);
+    }
+    try output_dir.writeFile(.{ .sub_path = output_path, .data = encoded });
+}
+
+// The samples of a RIFF WAVE file in the canonical format, which audio_assets.py writes.
+fn pcmFrames(wav: []align(@alignOf(adpcm.Frame)) const u8) ![]const adpcm.Frame {
+    if (wav.len < 12 or !std.mem.eql(u8, wav[0..4], "RIFF") or !std.mem.eql(u8, wav[8..12], "WAVE")) return error.NotWav;
+
+    var offset: usize = 12;
+    var canonical = false;
+
+    while (offset + 8 <= wav.len) {
+        const chunk_id = wav[offset..][0..4];
+        const chunk_size = std.mem.readInt(u32, wav[offset + 4 ..][0..4], .little);
+        const chunk_start = offset + 8;
+
+        if (chunk_start + chunk_size > wav.len) return error.NotWav;
+
+        if (std.mem.eql(u8, chunk_id, "fmt ")) {
+            if (chunk_size < 16) return error.NotWav;
+            const format = wav[chunk_start..][0..16];
+
+            canonical = std.mem.readInt(u16, format[0..2], .little) == 1 and // PCM.
+                std.mem.readInt(u16, format[2..4], .little) == adpcm.CHANNELS and
+                std.mem.readInt(u32, format[4..8], .little) == FREQUENCY and
+                std.mem.readInt(u16, format[14..16], .little) == 16;
+        } else if (std.mem.eql(u8, chunk_id, "data")) {
+            if (!canonical) return error.NotConverted;
+            // The data chunk of a file written by python's wave module starts 4 byte aligned.
+            if (chunk_start % @alignOf(adpcm.Frame) != 0) return error.Misaligned;
+
+            const frames: [*]const adpcm.Frame = @ptrCast(@alignCast(wav[chunk_start..].ptr));
+            return frames[0 .. chunk_size / @sizeOf(adpcm.Frame)];
+        }
+
+        offset = chunk_start + chunk_size + chunk_size % 2;
+    }
+
+    return error.NotWav;
+}
@@ -0,0 +1,118 @@
+/// Frame time statistics: how long each frame's work took, how long it then waited for the next timestep, and how
+/// many frames missed their deadline. Kept in fixed size log histograms, so recording never allocates and costs the
+/// same however long the game runs.
+const std = @import("std");
+
+const constants = @import("constants.zig");
+
+// Each power of two is split into 2^SUB_BITS buckets, so a reported percentile is within 1/2^SUB_BITS of the truth.
+const SUB_BITS = 3;
+const SUB_BUCKETS = 1 << SUB_BITS;
+const NUM_BUCKETS = (64 - SUB_BITS + 1) * SUB_BUCKETS;
+
+pub const Histogram = struct {
+    counts: [NUM_BUCKETS]u32 = .{0} ** NUM_BUCKETS,
+    count: u64 = 0,
+    max: u64 = 0,
+
+    fn bucketOf(value: u64) usize {
+        if (value < SUB_BUCKETS) return @intCast(value);
+
+        const exponent: usize = 63 - @clz(value);
+        const mantissa: usize = @intCast((value >> @intCast(exponent - SUB_BITS)) & (SUB_BUCKETS - 1));
+
+        return (exponent - SUB_BITS + 1) * SUB_BUCKETS + mantissa;
+    }
+
+    // The largest value that lands in the bucket.
+    fn bucketMax(bucket: usize) u64 {
+        if (bucket < SUB_BUCKETS) return bucket;
+
+        const shift: u6 = @intCast(bucket / SUB_BUCKETS - 1);
+        const lowest = @as(u64, SUB_BUCKETS + bucket % SUB_BUCKETS) << shift;
+
+        return lowest + ((@as(u64, 1) << shift) - 1);
+    }
+
+    pub fn record(self: *Histogram, value: u64) void {
+        self.counts[bucketOf(value)] +|= 1;
+        self.count += 1;
+        self.max = @max(self.max, value);
+    }
+
+    // The value below which the given fraction of recorded values are, rounded up to its bucket.
+    pub fn percentile(self: Histogram, fraction: f64) u64 {
+        if (self.count == 0) return 0;
+
+        const rank: u64 = @max(1, @as(u64, @intFromFloat(@ceil(fraction * @as(f64, @floatFromInt(self.count))))));
+        var seen: u64 = 0;
+
+        for (self.counts, 0..) |bucket_count, bucket| {
+            seen += bucket_count;
+            if (seen >= rank) return @min(bucketMax(bucket), self.max);
+        }
+        return self.max;
+    }
+};
+
+pub const FrameStats = struct {
+    work: Histogram = .{},
+    wait: Histogram = .{},
+    total: Histogram = .{},
+    missed_deadlines: u64 = 0, // Frames whose work alone took longer than TIMESTEP_NS.
+
+    pub fn record(self: *FrameStats, work_ns: u64, total_ns: u64) void {
+        self.work.record(work_ns);
+        self.wait.record(total_ns -| work_ns);
+        self.total.record(total_ns);
+
+        if (work_ns > constants.TIMESTEP_NS) self.missed_deadlines += 1;
+    }
+
+    pub fn print(self: *const FrameStats) void {
+        std.debug.print("\nFrames: {d}, {d} missed the {d:.2} ms deadline.", .{
+            self.total.count,
+            self.missed_deadlines,
+            @as(f64, @floatFromInt(constants.TIMESTEP_NS)) / std.time.ns_per_ms,
+        });
+
+        inline for (.{ "work", "wait", "total" }) |name| {
+            const histogram = @field(self, name);
+
+            std.debug.print("\n  {s:<5} p50 {d:>7.3} ms, p95 {d:>7.3} ms, p99 {d:>7.3} ms, max {d:>7.3} ms", .{
+                name,
+                toMilliseconds(histogram.percentile(0.50)),
+                toMilliseconds(histogram.percentile(0.95)),
+                toMilliseconds(histogram.percentile(0.99)),
+                toMilliseconds(histogram.max),
+            });
+        }
+    }
+};
+
+fn toMilliseconds(ns: u64) f64 {
+    return @as(f64, @floatFromInt(ns)) / std.time.ns_per_ms;
+}
+
+test "Histogram percentiles are within a bucket of the values" {
+    var histogram = Histogram{};
+
+    for (1..1001) |i| {
+        histogram.record(i * 1000);
+    }
+
+    try std.testing.expectEqual(1000, histogram.count);
+    try std.testing.expectEqual(1_000_000, histogram.max);
+
+    for ([_]f64{ 0.5, 0.95, 0.99 }) |fraction| {
+        const exact = fraction * 1_000_000;
+        const reported: f64 = @floatFromInt(histogram.percentile(fraction));
+
+        try std.testing.expect(reported >= exact and reported <= exact * (1 + 1.0 / SUB_BUCKETS));
+    }
+    try std.testing.expectEqual(1_000_000, histogram.percentile(1));
+
+    for ([_]u64{ 0, 7, 8, 9, 1000, std.math.maxInt(u64) }) |value| {
+        try std.testing.expect(Histogram.bucketMax(Histogram.bucketOf(value)) >= value);
+    }
+}
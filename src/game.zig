@@ -14,6 +14,8 @@ const SDL_Window = @import("sdl2").SDL_Window;
 const constants = @import("constants.zig");
 const utils = @import("utils.zig");
 const stages = @import("stages.zig");
+const profile = @import("profile.zig");
+const FrameStats = @import("frame_stats.zig").FrameStats;
 
 // Private Types
 const float = @import("types.zig").float;
@@ -23,6 +25,8 @@ const EntityMode = @import("visual_assets.zig").EntityMode;
 const VisualAssetID = @import("visual_assets.zig").ID;
 const DontLoadMode = @import("visual_assets.zig").DontLoadMode;
 const ASSETS_PER_ID = @import("visual_assets.zig").ASSETS_PER_ID;
+const GROUP_PER_ID = @import("visual_assets.zig").GROUP_PER_ID;
+const VisualAssetGroup = @import("visual_assets.zig").Group;
 const AudioAssetID = @import("audio_assets.zig").ID;
 const CharacterState = @import("state_machine.zig").CharacterState;
 const CharacterMovement = @import("state_machine.zig").CharacterMovement;
@@ -52,6 +56,7 @@ pub const Game = struct {
     sim_state: *SimulatorState,
     stage_assets: stages.StageAssets = undefined,
     timer: std.time.Timer,
+    frame_stats: FrameStats = .{}, // Of every frame paced by wait_for_end_of_frame.
     num_players: u8,
 
     pub fn init(
@@ -75,6 +80,7 @@ pub const Game = struct {
     pub fn deinit(self: *Game) void {
         self.input_handler.deinit();
         self.audio_player.deinit();
+        self.frame_stats.print();
         self.renderer.deinit(); // Calls SDL_Quit(), must therefore be called after other structs that use SDL.
     }
 
@@ -106,7 +112,7 @@ pub const Game = struct {
         game_outer_loop: while (true) {
             var counter: u64 = 0;
 
-            // self.audio_player.play(AudioAssetID.MENU_MUSIC_TRACK1, 0);
+            // self.audio_player.playMusic(AudioAssetID.MENU_MUSIC_TRACK1, 0, 1);
 
             // TODO: Clean this up a bit. Too much branching.
             // Select stage and characters.
@@ -148,6 +154,10 @@ pub const Game = struct {
                 const previous_stage = current_stage;
                 current_stage = current_stage.switch_stage(direction);
 
+                // Whatever is highlighted may be picked next, so have it ready by then.
+                self.renderer.prefetch_asset_group(stages.stageGroup(current_stage));
+                self.renderer.prefetch_asset_group(.MENU_STAGE);
+
                 if (previous_stage == current_stage) {
                     self.draw_stage_select_animation(counter, current_stage);
                 } else {
@@ -253,9 +263,18 @@ pub const Game = struct {
     }
 
     fn wait_for_end_of_frame(self: *Game) void {
-        while (self.timer.read() < constants.TIMESTEP_NS) {
+        const zone = profile.zone("wait_for_end_of_frame");
+        const work_ns = self.timer.read();
+        var total_ns = work_ns;
+
+        while (total_ns < constants.TIMESTEP_NS) {
             std.atomic.spinLoopHint(); // Do nothing.
+            total_ns = self.timer.read();
         }
+
+        self.frame_stats.record(work_ns, total_ns);
+        zone.end();
+        profile.endFrame();
     }
 
     fn quit_game_hold_loop(self: *Game) bool {
@@ -586,6 +605,8 @@ pub const Game = struct {
                     self.sim_state.physics_state.Y[character_created_entity_index] = self.sim_state.physics_state.Y[player];
                     self.sim_state.physics_state.dX[character_created_entity_index] = character_created_entity.horizontal_velocity;
                     self.sim_state.physics_state.dY[character_created_entity_index] = character_created_entity.vertical_velocity;
+
+                    _ = self.audio_player.playAt(AudioAssetID.GAME_EFFECTS_SHOT, 0, 1, character_created_entity_index);
                 },
                 else => {
                     std.debug.print("wtf: {any}", .{character_created_entity.entity_mode});
@@ -621,6 +642,8 @@ pub const Game = struct {
 
                 self.player_characters[player].resources.health_points -|= @intFromFloat(damage);
                 // TODO: Transition to hitstun state.
+
+                if (damage > 0) _ = self.audio_player.playAt(AudioAssetID.GAME_EFFECTS_HIT, 0, 1, player);
             }
 
             // TODO: Temporary inline implementation for testing.
@@ -655,6 +678,8 @@ pub const Game = struct {
 
                 self.player_characters[player].resources.health_points -|= @intFromFloat(damage);
                 // TODO: Transition to hitstun state.
+
+                if (damage > 0) _ = self.audio_player.playAt(AudioAssetID.GAME_EFFECTS_HIT, 0, 1, player);
             }
         }
 
@@ -665,8 +690,9 @@ pub const Game = struct {
         self.sim_state.gamePhysics(self.dynamic_entities.active);
 
         self.dynamic_entities.updatePosition(self.sim_state.physics_state.X, self.sim_state.physics_state.Y);
+        self.audio_player.followEntities(self.sim_state.physics_state.X);
 
-        self.renderer.draw_looping_animations(counter, self.stage_assets.background, constants.ANIMATION_SLOWDOWN_FACTOR) catch unreachable;
+        self.renderer.draw_stage_background(counter, self.stage_assets.background, constants.ANIMATION_SLOWDOWN_FACTOR) catch unreachable;
         self.renderer.draw_dynamic_entities(counter, self.dynamic_entities, constants.ANIMATION_SLOWDOWN_FACTOR) catch unreachable;
         self.renderer.draw_looping_animations(counter, self.stage_assets.foreground, constants.ANIMATION_SLOWDOWN_FACTOR) catch unreachable;
 
@@ -696,6 +722,19 @@ pub const Game = struct {
         self.dynamic_entities.init(starting_positions, shuffled_indices, entity_modes);
         self.sim_state.init(starting_positions, shuffled_indices);
         self.stage_assets = stages.stageAssets(stage_id);
+
+        // Load everything the match draws up front, rather than stalling on its first frames.
+        self.renderer.require_asset_group(stages.stageGroup(stage_id));
+        for (entity_modes) |mode| {
+            const id = IDFromEntityMode(mode);
+            if (id != .DONT_LOAD_TEXTURE) self.renderer.require_asset_group(GROUP_PER_ID[id.int()]);
+        }
+        for ([_]VisualAssetGroup{ .PROJECTILE_TEST, .UI_AMMO, .UI_HEALTH }) |group| {
+            self.renderer.require_asset_group(group);
+        }
+        self.renderer.prefetch_asset_group(.UI_PAUSED);
+
+        self.renderer.prepare_static_background(self.stage_assets.background);
     }
 
     fn handle_character_action(
@@ -707,6 +746,9 @@ pub const Game = struct {
         action: PlayerAction,
         global_counter: u64,
     ) struct { EntityMode, CharacterMovement, AnimationCounterCorrection, CharacterCreatedEntity } {
+        const zone = profile.zone("handle_character_action");
+        defer zone.end();
+
         current_character_state.resources.has_jump = floor_collision or current_character_state.resources.has_jump;
 
         switch (current_entity_mode) {
@@ -877,6 +919,9 @@ pub const InputHandler = struct {
         self: *InputHandler,
         player_actions: []PlayerAction,
     ) void {
+        const zone = profile.zone("update_player_actions_inplace");
+        defer zone.end();
+
         for (0..self.num_devices) |i| {
             const report = @atomicLoad(
                 UsbGamepadReport,
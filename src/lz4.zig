@@ -0,0 +1,198 @@
+/// LZ4 block format (no frame format), used for the asset pack.
+/// Compression is a greedy single-probe hash search, which is only run at build time.
+/// Decompression does no allocation, and checks every length and offset against the buffers it's given.
+const std = @import("std");
+
+const MIN_MATCH = 4;
+const LAST_LITERALS = 5; // The last 5 bytes of a block are always literals.
+const MATCH_FIND_LIMIT = 12; // No match may start in the last 12 bytes of a block.
+const MAX_OFFSET = 65535;
+const HASH_LOG = 16;
+
+pub const DecompressError = error{CorruptInput};
+
+pub fn compressBound(size: usize) usize {
+    return size + size / 255 + 16;
+}
+
+fn read32(bytes: []const u8, index: usize) u32 {
+    return std.mem.readInt(u32, bytes[index..][0..4], .little);
+}
+
+fn hash(sequence: u32) usize {
+    return @as(u32, sequence *% 2654435761) >> (32 - HASH_LOG);
+}
+
+// Returns the compressed size. dst must hold at least compressBound(src.len) bytes.
+pub fn compress(src: []const u8, dst: []u8) usize {
+    std.debug.assert(dst.len >= compressBound(src.len));
+
+    var table: [1 << HASH_LOG]u32 = .{0} ** (1 << HASH_LOG);
+    var in: usize = 0;
+    var out: usize = 0;
+    var anchor: usize = 0;
+
+    if (src.len > MATCH_FIND_LIMIT) {
+        const match_start_limit = src.len - MATCH_FIND_LIMIT;
+        const match_end_limit = src.len - LAST_LITERALS;
+
+        while (in < match_start_limit) {
+            const sequence = read32(src, in);
+            const slot = hash(sequence);
+            var reference: usize = table[slot];
+            table[slot] = @intCast(in);
+
+            if (reference >= in or in - reference > MAX_OFFSET or read32(src, reference) != sequence) {
+                // Step faster through data that doesn't compress.
+                in += 1 + ((in - anchor) >> 6);
+                continue;
+            }
+
+            var match_start = in;
+            var match_end = in + MIN_MATCH;
+            reference += MIN_MATCH;
+
+            while (match_end < match_end_limit and src[match_end] == src[reference]) {
+                match_end += 1;
+                reference += 1;
+            }
+
+            reference -= match_end - match_start;
+            while (match_start > anchor and reference > 0 and src[match_start - 1] == src[reference - 1]) {
+                match_start -= 1;
+                reference -= 1;
+            }
+
+            out = writeSequence(dst, out, src[anchor..match_start], match_start - reference, match_end - match_start);
+            in = match_end;
+            anchor = in;
+        }
+    }
+
+    return writeSequence(dst, out, src[anchor..], 0, 0);
+}
+
+// A match length of 0 writes the final, literal-only sequence.
+fn writeSequence(dst: []u8, start: usize, literals: []const u8, offset: usize, match_length: usize) usize {
+    var out = start;
+    const token = out;
+    out += 1;
+
+    const literal_nibble: u8 = @intCast(@min(literals.len, 15));
+    if (literals.len >= 15) out = writeLengthExtension(dst, out, literals.len - 15);
+
+    @memcpy(dst[out..][0..literals.len], literals);
+    out += literals.len;
+
+    if (match_length == 0) {
+        dst[token] = literal_nibble << 4;
+        return out;
+    }
+
+    std.mem.writeInt(u16, dst[out..][0..2], @intCast(offset), .little);
+    out += 2;
+
+    const extra_length = match_length - MIN_MATCH;
+    const match_nibble: u8 = @intCast(@min(extra_length, 15));
+    if (extra_length >= 15) out = writeLengthExtension(dst, out, extra_length - 15);
+
+    dst[token] = (literal_nibble << 4) | match_nibble;
+    return out;
+}
+
+fn writeLengthExtension(dst: []u8, start: usize, length: usize) usize {
+    var out = start;
+    var remaining = length;
+
+    while (remaining >= 255) : (remaining -= 255) {
+        dst[out] = 255;
+        out += 1;
+    }
+    dst[out] = @intCast(remaining);
+
+    return out + 1;
+}
+
+fn readLengthExtension(src: []const u8, in: *usize, length: *usize) DecompressError!void {
+    while (true) {
+        if (in.* >= src.len) return error.CorruptInput;
+        const byte = src[in.*];
+        in.* += 1;
+        length.* += byte;
+        if (byte != 255) return;
+    }
+}
+
+// Returns the decompressed size.
+pub fn decompress(src: []const u8, dst: []u8) DecompressError!usize {
+    var in: usize = 0;
+    var out: usize = 0;
+
+    while (true) {
+        if (in >= src.len) return error.CorruptInput;
+        const token = src[in];
+        in += 1;
+
+        var literal_length: usize = token >> 4;
+        if (literal_length == 15) try readLengthExtension(src, &in, &literal_length);
+
+        if (literal_length > src.len - in or literal_length > dst.len - out) return error.CorruptInput;
+        @memcpy(dst[out..][0..literal_length], src[in..][0..literal_length]);
+        in += literal_length;
+        out += literal_length;
+
+        if (in == src.len) return out;
+
+        if (src.len - in < 2) return error.CorruptInput;
+        const offset: usize = std.mem.readInt(u16, src[in..][0..2], .little);
+        in += 2;
+
+        var match_length: usize = token & 15;
+        if (match_length == 15) try readLengthExtension(src, &in, &match_length);
+        match_length += MIN_MATCH;
+
+        if (offset == 0 or offset > out or match_length > dst.len - out) return error.CorruptInput;
+
+        // Overlapping matches repeat the last `offset` bytes. The repeated region doubles with every copy,
+        // which keeps long runs of one pixel (offset 4) fast.
+        const match_start = out - offset;
+        var remaining = match_length;
+
+        while (remaining > 0) {
+            const length = @min(remaining, out - match_start);
+            @memcpy(dst[out..][0..length], dst[match_start..][0..length]);
+            out += length;
+            remaining -= length;
+        }
+    }
+}
+
+test "lz4 round trip" {
+    const testing = std.testing;
+
+    var input: [4096]u8 = undefined;
+    var prng = std.Random.DefaultPrng.init(0);
+
+    // Mix runs of one pixel, repeated rows and noise, like trimmed sprites do.
+    for (0..input.len / 4) |pixel| {
+        const value: u32 = if (pixel % 300 < 200) 0xFF102030 else if (pixel % 300 < 250) @intCast(pixel % 7) else prng.random().int(u32);
+        std.mem.writeInt(u32, input[pixel * 4 ..][0..4], value, .little);
+    }
+
+    var compressed: [compressBound(input.len)]u8 = undefined;
+    const compressed_size = compress(&input, &compressed);
+    try testing.expect(compressed_size < input.len);
+
+    var output: [input.len]u8 = undefined;
+    try testing.expectEqual(input.len, try decompress(compressed[0..compressed_size], &output));
+    try testing.expectEqualSlices(u8, &input, &output);
+
+    // Blocks too small for any match are stored as literals.
+    const tiny = "battlebuds";
+    var tiny_compressed: [compressBound(tiny.len)]u8 = undefined;
+    const tiny_size = compress(tiny, &tiny_compressed);
+    try testing.expectEqual(tiny.len, try decompress(tiny_compressed[0..tiny_size], output[0..tiny.len]));
+    try testing.expectEqualSlices(u8, tiny, output[0..tiny.len]);
+
+    try testing.expectError(error.CorruptInput, decompress(compressed[0 .. compressed_size - 1], &output));
+}
@@ -0,0 +1,82 @@
+/// Lock-free queue with any number of producers and a single consumer, over intrusive nodes.
+/// Producers push onto an atomic stack. The consumer takes the whole stack in one swap and reverses it,
+/// so items come out in the order they were pushed, and there is no ABA problem since nodes are never
+/// popped one by one from the shared stack.
+const std = @import("std");
+
+pub fn MpscQueue(comptime T: type) type {
+    return struct {
+        const Self = @This();
+
+        pub const Node = struct {
+            next: ?*Node = null,
+            value: T,
+        };
+
+        stack: std.atomic.Value(?*Node) = std.atomic.Value(?*Node).init(null),
+        consumer_list: ?*Node = null, // Only touched by the consumer.
+
+        pub fn push(self: *Self, node: *Node) void {
+            var top = self.stack.load(.monotonic);
+
+            while (true) {
+                node.next = top;
+                top = self.stack.cmpxchgWeak(top, node, .release, .monotonic) orelse return;
+            }
+        }
+
+        // Consumer only.
+        pub fn pop(self: *Self) ?*Node {
+            if (self.consumer_list == null) {
+                var stack = self.stack.swap(null, .acquire);
+
+                while (stack) |node| {
+                    stack = node.next;
+                    node.next = self.consumer_list;
+                    self.consumer_list = node;
+                }
+            }
+
+            const node = self.consumer_list orelse return null;
+            self.consumer_list = node.next;
+
+            return node;
+        }
+    };
+}
+
+test "MpscQueue keeps each producer's order" {
+    const Queue = MpscQueue(struct { producer: usize, index: usize });
+    const NUM_PRODUCERS = 4;
+    const NUM_ITEMS = 1000;
+
+    var queue: Queue = .{};
+    var nodes: [NUM_PRODUCERS][NUM_ITEMS]Queue.Node = undefined;
+
+    const produce = struct {
+        fn produce(producer_queue: *Queue, producer_nodes: *[NUM_ITEMS]Queue.Node, producer: usize) void {
+            for (producer_nodes, 0..) |*node, index| {
+                node.* = .{ .value = .{ .producer = producer, .index = index } };
+                producer_queue.push(node);
+            }
+        }
+    }.produce;
+
+    var threads: [NUM_PRODUCERS]std.Thread = undefined;
+    for (&threads, &nodes, 0..) |*thread, *producer_nodes, producer| {
+        thread.* = try std.Thread.spawn(.{}, produce, .{ &queue, producer_nodes, producer });
+    }
+
+    var next_index: [NUM_PRODUCERS]usize = .{0} ** NUM_PRODUCERS;
+    var num_popped: usize = 0;
+
+    while (num_popped < NUM_PRODUCERS * NUM_ITEMS) {
+        const node = queue.pop() orelse continue;
+
+        try std.testing.expectEqual(next_index[node.value.producer], node.value.index);
+        next_index[node.value.producer] += 1;
+        num_popped += 1;
+    }
+
+    for (threads) |thread| thread.join();
+}
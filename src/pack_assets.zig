@@ -0,0 +1,281 @@
+/// Build-time tool: decodes every PNG in visual_assets.ALL once, and writes the trimmed, LZ4 compressed
+/// pixels to an asset pack. Duplicate frames are left out, since the game shares the original's texture,
+/// and delta encoded animations are stored as a first frame plus the changed region of every other frame.
+/// Other frames with at most 256 colours are stored as a palette plus one index per pixel.
+/// Usage: pack_assets <output path>, run from the project root (asset paths are relative to it).
+const std = @import("std");
+const rgbapng = @import("rgbapng");
+
+const visual_assets = @import("visual_assets.zig");
+const asset_pack = @import("asset_pack.zig");
+const lz4 = @import("lz4.zig");
+
+// Compressed chunks of one asset, back to back.
+const PackedAsset = struct {
+    data: std.ArrayList(u8) = std.ArrayList(u8).init(std.heap.page_allocator),
+    chunk_sizes: std.ArrayList(u32) = std.ArrayList(u32).init(std.heap.page_allocator),
+    width: u16 = 0, // Of the stored pixels.
+    height: u16 = 0,
+    changed: asset_pack.Rect = .{},
+    palette_size: u16 = 0,
+};
+
+pub fn main() !void {
+    var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena.deinit();
+
+    const args = try std.process.argsAlloc(arena.allocator());
+    if (args.len != 2) {
+        std.debug.print("Usage: {s} <output path>\n", .{args[0]});
+        return error.InvalidArguments;
+    }
+
+    var packed_assets: [visual_assets.ALL.len]PackedAsset = .{PackedAsset{}} ** visual_assets.ALL.len;
+    defer {
+        for (&packed_assets) |*packed_asset| {
+            packed_asset.data.deinit();
+            packed_asset.chunk_sizes.deinit();
+        }
+    }
+
+    // Compressed sizes aren't known up front, so workers compress in memory and the file is laid out afterwards.
+    var pool: std.Thread.Pool = undefined;
+    try pool.init(.{ .allocator = arena.allocator() });
+    defer pool.deinit();
+
+    var wait_group: std.Thread.WaitGroup = .{};
+    var failed = std.atomic.Value(bool).init(false);
+
+    for (visual_assets.ALL, &packed_assets, 0..) |asset, *packed_asset, asset_index| {
+        if (visual_assets.DELTA_CANVAS_PER_ID[asset.id.int()] == null) {
+            pool.spawnWg(&wait_group, packAsset, .{ asset, packed_asset, &failed });
+            continue;
+        }
+
+        // Frames of a delta encoded animation depend on each other, so the whole animation is one task.
+        if (asset_index > 0 and visual_assets.ALL[asset_index - 1].id == asset.id) continue;
+
+        const num_frames = visual_assets.ASSETS_PER_ID[asset.id.int()];
+        pool.spawnWg(&wait_group, packDeltaAnimation, .{ asset_index, packed_assets[asset_index..][0..num_frames], &failed });
+    }
+    pool.waitAndWork(&wait_group);
+
+    if (failed.load(.acquire)) return error.PackingFailed;
+
+    var num_chunks: usize = 0;
+    for (packed_assets) |packed_asset| {
+        num_chunks += packed_asset.chunk_sizes.items.len;
+    }
+
+    var entries: [visual_assets.ALL.len]asset_pack.Entry = undefined;
+    const chunks = try arena.allocator().alloc(asset_pack.Chunk, num_chunks);
+
+    var offset = asset_pack.firstChunkOffset(entries.len, num_chunks);
+    var chunk_index: usize = 0;
+    var raw_size: usize = 0;
+
+    for (packed_assets, &entries) |packed_asset, *entry| {
+        entry.* = .{
+            .offset = offset,
+            .size = packed_asset.data.items.len,
+            .width = packed_asset.width,
+            .height = packed_asset.height,
+            .first_chunk = @intCast(chunk_index),
+            .num_chunks = @intCast(packed_asset.chunk_sizes.items.len),
+            .changed = packed_asset.changed,
+            .palette_size = packed_asset.palette_size,
+        };
+
+        if (!entry.isStored()) continue;
+
+        var remaining_raw_size = entry.rawSize();
+        raw_size += remaining_raw_size;
+
+        for (packed_asset.chunk_sizes.items) |chunk_size| {
+            const chunk_raw_size = @min(remaining_raw_size, asset_pack.CHUNK_SIZE);
+
+            chunks[chunk_index] = .{ .offset = offset, .size = chunk_size, .raw_size = @intCast(chunk_raw_size) };
+            chunk_index += 1;
+            offset += chunk_size;
+            remaining_raw_size -= chunk_raw_size;
+        }
+    }
+
+    const file = try std.fs.cwd().createFile(args[1], .{});
+    defer file.close();
+
+    var buffered_writer = std.io.bufferedWriter(file.writer());
+    const writer = buffered_writer.writer();
+
+    try writer.writeAll(std.mem.asBytes(&asset_pack.Header{ .num_entries = entries.len, .num_chunks = @intCast(num_chunks) }));
+    try writer.writeAll(std.mem.sliceAsBytes(&entries));
+    try writer.writeAll(std.mem.sliceAsBytes(chunks));
+
+    for (packed_assets) |packed_asset| {
+        try writer.writeAll(packed_asset.data.items);
+    }
+    try buffered_writer.flush();
+
+    std.debug.print("\nPacked {d} assets: {d} MB of pixels in {d} MB.\n", .{ entries.len, raw_size >> 20, offset >> 20 });
+}
+
+fn packAsset(asset: visual_assets.Asset, packed_asset: *PackedAsset, failed: *std.atomic.Value(bool)) void {
+    if (asset.duplicate_of != null) return;
+
+    compressTrimmedPixels(asset, packed_asset) catch |err| {
+        std.debug.print("\nFailed to pack {s}: {s}", .{ asset.path, @errorName(err) });
+        failed.store(true, .release);
+    };
+}
+
+fn packDeltaAnimation(first_asset: usize, packed_assets: []PackedAsset, failed: *std.atomic.Value(bool)) void {
+    compressDeltaAnimation(first_asset, packed_assets) catch |err| {
+        std.debug.print("\nFailed to pack {s}: {s}", .{ visual_assets.ALL[first_asset].path, @errorName(err) });
+        failed.store(true, .release);
+    };
+}
+
+// The pixels a texture holds: the trimmed rectangle of the decoded PNG, rows tightly packed.
+pub fn decodeTrimmedPixels(asset: visual_assets.Asset, arena: *std.heap.ArenaAllocator) ![]u8 {
+    return decodeCroppedPixels(asset, asset.trim, arena);
+}
+
+// A rectangle of the decoded PNG, rows tightly packed. Only the position and size of the crop are used.
+fn decodeCroppedPixels(asset: visual_assets.Asset, crop: visual_assets.Trim, arena: *std.heap.ArenaAllocator) ![]u8 {
+    const image = try rgbapng.decode(.{ .optimistic = true }, asset.path, arena.allocator());
+    const trim = asset.trim;
+
+    if (image.width != trim.full_width or image.height != trim.full_height) return error.StaleTrim;
+
+    return cropPixels(image.data, image.stride, .{ .x = crop.x, .y = crop.y, .width = crop.width, .height = crop.height }, arena.allocator());
+}
+
+fn cropPixels(data: []const u8, stride: usize, rect: asset_pack.Rect, allocator: std.mem.Allocator) ![]u8 {
+    const row_size = @as(usize, rect.width) * @sizeOf(u32);
+    const pixels = try allocator.alloc(u8, row_size * rect.height);
+
+    for (0..rect.height) |row| {
+        const start = (rect.y + row) * stride + @as(usize, rect.x) * @sizeOf(u32);
+        @memcpy(pixels[row * row_size ..][0..row_size], data[start..][0..row_size]);
+    }
+
+    return pixels;
+}
+
+fn compressTrimmedPixels(asset: visual_assets.Asset, packed_asset: *PackedAsset) !void {
+    var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena.deinit();
+
+    packed_asset.width = asset.trim.width;
+    packed_asset.height = asset.trim.height;
+
+    const pixels = try decodeTrimmedPixels(asset, &arena);
+
+    if (try indexPixels(pixels, arena.allocator())) |indexed| {
+        packed_asset.palette_size = indexed.palette_size;
+        try compressPixels(indexed.data, packed_asset, &arena);
+    } else {
+        try compressPixels(pixels, packed_asset, &arena);
+    }
+}
+
+const IndexedPixels = struct {
+    palette_size: u16,
+    data: []u8, // The palette's colours, then one index per pixel.
+};
+
+// Returns null if the pixels have more than 256 colours. Fully transparent pixels all become 0, since their color
+// is never seen, which keeps anti-aliased sprites with stray transparent colours under the limit.
+fn indexPixels(pixels: []const u8, allocator: std.mem.Allocator) !?IndexedPixels {
+    const colors = std.mem.bytesAsSlice(u32, pixels);
+
+    var palette = std.AutoArrayHashMap(u32, void).init(allocator);
+    defer palette.deinit();
+
+    const indices = try allocator.alloc(u8, colors.len);
+
+    for (colors, indices) |color, *index| {
+        const visible_color = if (color >> 24 == 0) 0 else color;
+        const entry = try palette.getOrPut(visible_color);
+
+        if (entry.index >= 256) return null;
+        index.* = @intCast(entry.index);
+    }
+
+    const palette_bytes = std.mem.sliceAsBytes(palette.keys());
+    const data = try allocator.alloc(u8, palette_bytes.len + indices.len);
+    @memcpy(data[0..palette_bytes.len], palette_bytes);
+    @memcpy(data[palette_bytes.len..], indices);
+
+    return .{ .palette_size = @intCast(palette.count()), .data = data };
+}
+
+// Every frame is cropped to the animation's canvas. The first is stored whole, the others only where they differ
+// from the frame before them, and each frame records where it differs from the one before it (cyclically),
+// which is what the game uploads when stepping the animation.
+fn compressDeltaAnimation(first_asset: usize, packed_assets: []PackedAsset) !void {
+    var arena = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena.deinit();
+
+    const canvas = visual_assets.DELTA_CANVAS_PER_ID[visual_assets.ALL[first_asset].id.int()].?;
+    const canvas_stride = @as(usize, canvas.width) * @sizeOf(u32);
+    const frames = try arena.allocator().alloc([]u8, packed_assets.len);
+
+    for (frames, first_asset..) |*frame, asset_index| {
+        frame.* = try decodeCroppedPixels(visual_assets.ALL[asset_index], canvas, &arena);
+    }
+
+    for (packed_assets, frames, 0..) |*packed_asset, frame, frame_index| {
+        const previous = frames[(frame_index + frames.len - 1) % frames.len];
+        const changed = changedRect(previous, frame, canvas.width, canvas.height);
+        const stored = if (frame_index == 0) asset_pack.Rect{ .width = canvas.width, .height = canvas.height } else changed;
+
+        packed_asset.width = stored.width;
+        packed_asset.height = stored.height;
+        packed_asset.changed = changed;
+
+        try compressPixels(try cropPixels(frame, canvas_stride, stored, arena.allocator()), packed_asset, &arena);
+    }
+}
+
+// Bounding box of the pixels that look different. Fully transparent pixels all look the same, whatever their color.
+fn changedRect(previous: []const u8, current: []const u8, width: usize, height: usize) asset_pack.Rect {
+    const previous_pixels = std.mem.bytesAsSlice(u32, previous);
+    const current_pixels = std.mem.bytesAsSlice(u32, current);
+
+    var x_min: usize = width;
+    var x_max: usize = 0;
+    var y_min: usize = height;
+    var y_max: usize = 0;
+
+    for (0..height) |y| {
+        const previous_row = previous_pixels[y * width ..][0..width];
+        const current_row = current_pixels[y * width ..][0..width];
+
+        for (previous_row, current_row, 0..) |previous_pixel, current_pixel, x| {
+            const invisible = (previous_pixel | current_pixel) >> 24 == 0;
+            if (previous_pixel == current_pixel or invisible) continue;
+
+            x_min = @min(x_min, x);
+            x_max = @max(x_max, x + 1);
+            y_min = @min(y_min, y);
+            y_max = y + 1;
+        }
+    }
+
+    if (x_max <= x_min) return .{};
+
+    return .{ .x = @intCast(x_min), .y = @intCast(y_min), .width = @intCast(x_max - x_min), .height = @intCast(y_max - y_min) };
+}
+
+fn compressPixels(pixels: []const u8, packed_asset: *PackedAsset, arena: *std.heap.ArenaAllocator) !void {
+    const compressed = try arena.allocator().alloc(u8, lz4.compressBound(asset_pack.CHUNK_SIZE));
+
+    for (0..asset_pack.numChunks(pixels.len)) |chunk_index| {
+        const chunk = pixels[chunk_index * asset_pack.CHUNK_SIZE ..][0..@min(pixels.len - chunk_index * asset_pack.CHUNK_SIZE, asset_pack.CHUNK_SIZE)];
+        const size = asset_pack.compressChunk(chunk, compressed);
+
+        try packed_asset.data.appendSlice(compressed[0..size]);
+        try packed_asset.chunk_sizes.append(@intCast(size));
+    }
+}
@@ -3,6 +3,7 @@ const constants = @import("constants.zig");
 const std = @import("std");
 const utils = @import("utils.zig");
 const stages = @import("stages.zig");
+const profile = @import("profile.zig");
 
 const float = @import("types.zig").float;
 const Vec = @import("types.zig").Vec;
@@ -127,6 +128,9 @@ pub const SimulatorState = struct {
     }
 
     pub fn newtonianMotion(self: *SimulatorState, dt: float) void {
+        const zone = profile.zone("newtonianMotion");
+        defer zone.end();
+
         self.physics_state.X = posVelAccTimeRelation(dt, self.physics_state.X, self.physics_state.dX, self.physics_state.ddX);
         self.physics_state.Y = posVelAccTimeRelation(dt, self.physics_state.Y, self.physics_state.dY, self.physics_state.ddY);
         self.physics_state.dX = velAccTimeRelation(dt, self.physics_state.dX, self.physics_state.ddX);
@@ -251,6 +255,9 @@ pub const SimulatorState = struct {
     }
 
     pub fn resolveCollisions(self: *SimulatorState, geoms: []const stages.Shape) void {
+        const zone = profile.zone("resolveCollisions");
+        defer zone.end();
+
         // TODO: Rework dynamic entity hitboxes.
         // But when I have collision between bullets and characters, I need to check
         // ownership of the bullet somehow.
@@ -327,6 +334,9 @@ pub const SimulatorState = struct {
     }
 
     pub fn gamePhysics(self: *SimulatorState, active_entity: Vec) void {
+        const zone = profile.zone("gamePhysics");
+        defer zone.end();
+
         const gravity: Vec = @splat(-50.81);
         const friction_coeff: Vec = @splat(2.8);
         const drag_coeff: Vec = @splat(0.2);
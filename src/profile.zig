@@ -0,0 +1,119 @@
+/// Zone profiler for the game thread, written as a Chrome trace (open it in https://ui.perfetto.dev or chrome://tracing).
+/// Build with `-Dprofile_frames=N` to record N frames from frame `-Dprofile_first_frame`, otherwise every zone
+/// compiles to nothing. Once the last frame of the window ends, the trace is written to TRACE_PATH.
+/// Usage, around anything the game thread does:
+///     const zone = profile.zone("newtonianMotion");
+///     defer zone.end();
+const std = @import("std");
+
+const PROFILE_FRAMES: u32 = @import("build_options").profile_frames;
+const FIRST_FRAME: u32 = @import("build_options").profile_first_frame;
+
+pub const ENABLED = PROFILE_FRAMES > 0;
+pub const TRACE_PATH = "profile.json";
+
+const MAX_EVENTS_PER_FRAME = 256;
+
+const Event = struct {
+    name: []const u8,
+    start_ns: u64, // Since the profiler's first event.
+    duration_ns: u64,
+};
+
+// Game thread only, so nothing needs to be atomic.
+var events: [if (ENABLED) PROFILE_FRAMES * MAX_EVENTS_PER_FRAME else 0]Event = undefined;
+var num_events: usize = 0;
+var dropped_events: usize = 0;
+var frame: u32 = 0;
+var frame_start: ?std.time.Instant = null;
+var epoch: ?std.time.Instant = null; // When the window started, or the first zone did for a window from frame 0.
+
+pub const Zone = struct {
+    name: []const u8,
+    start: ?std.time.Instant, // Null outside of the frame window.
+
+    pub inline fn end(self: Zone) void {
+        if (!ENABLED) return;
+
+        if (self.start) |start| {
+            record(self.name, start, now());
+        }
+    }
+};
+
+pub inline fn zone(comptime name: []const u8) Zone {
+    if (!ENABLED or !recording()) return .{ .name = name, .start = null };
+
+    const start = now();
+    if (epoch == null) epoch = start;
+
+    return .{ .name = name, .start = start };
+}
+
+// Once per frame, after its last zone. Each frame shows up as a zone of its own, so the trace lines them up.
+pub fn endFrame() void {
+    if (!ENABLED) return;
+
+    const end = now();
+
+    if (recording()) {
+        if (frame_start) |start| record("frame", start, end);
+    }
+
+    frame += 1;
+    frame_start = end;
+
+    if (frame == FIRST_FRAME) epoch = end;
+
+    if (frame == FIRST_FRAME + PROFILE_FRAMES) {
+        writeTrace() catch |err| std.debug.print("\nFailed to write {s}: {s}", .{ TRACE_PATH, @errorName(err) });
+    }
+}
+
+fn recording() bool {
+    return frame >= FIRST_FRAME and frame < FIRST_FRAME + PROFILE_FRAMES;
+}
+
+fn now() std.time.Instant {
+    return std.time.Instant.now() catch unreachable;
+}
+
+fn record(name: []const u8, start: std.time.Instant, end: std.time.Instant) void {
+    if (num_events == events.len) {
+        dropped_events += 1;
+        return;
+    }
+
+    events[num_events] = .{ .name = name, .start_ns = start.since(epoch.?), .duration_ns = end.since(start) };
+    num_events += 1;
+}
+
+// Complete ("X") events, in microseconds. Zones nest by time, so the viewer shows them as a call tree per frame.
+fn writeTrace() !void {
+    const file = try std.fs.cwd().createFile(TRACE_PATH, .{});
+    defer file.close();
+
+    var buffered_writer = std.io.bufferedWriter(file.writer());
+    const writer = buffered_writer.writer();
+
+    try writer.writeAll("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+
+    for (events[0..num_events], 0..) |event, i| {
+        try writer.print("{{\"name\":\"{s}\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":{d:.3},\"dur\":{d:.3}}}{s}\n", .{
+            event.name,
+            @as(f64, @floatFromInt(event.start_ns)) / std.time.ns_per_us,
+            @as(f64, @floatFromInt(event.duration_ns)) / std.time.ns_per_us,
+            if (i + 1 < num_events) "," else "",
+        });
+    }
+
+    try writer.writeAll("]}\n");
+    try buffered_writer.flush();
+
+    std.debug.print("\nProfile: wrote {d} zones over {d} frames to {s} ({d} dropped).", .{
+        num_events,
+        PROFILE_FRAMES,
+        TRACE_PATH,
+        dropped_events,
+    });
+}
@@ -8,6 +8,15 @@ const constants = @import("constants.zig");
 const visual_assets = @import("visual_assets.zig");
 const utils = @import("utils.zig");
 const stages = @import("stages.zig");
+const software_render = @import("software_render.zig");
+const asset_pack = @import("asset_pack.zig");
+const work_pool = @import("work_pool.zig");
+const mpsc_queue = @import("mpsc_queue.zig");
+const profile = @import("profile.zig");
+
+const SOFTWARE_RENDERING = @import("build_options").software_rendering;
+const VISUAL_ASSET_PACK_NAME = "visual_assets.pack"; // Installed next to the executable.
+const Compositor = software_render.TiledCompositor(constants.X_RESOLUTION, constants.Y_RESOLUTION);
 
 const Vec = @import("types.zig").Vec;
 const VecI32 = @import("types.zig").VecI32;
@@ -83,6 +92,14 @@ pub const Renderer = struct {
     renderer: *SDL.SDL_Renderer = undefined,
     window: *SDL.SDL_Window = undefined,
     num_textures: u8 = undefined,
+    static_background: ?*SDL.SDL_Texture = null, // Render target holding the flattened single-frame stage layers.
+    num_static_background_layers: usize = 0,
+
+    // Only used when compositing in software.
+    framebuffer: software_render.Surface = undefined,
+    compositor: Compositor = .{},
+    static_background_surface: ?software_render.Surface = null,
+    screen: ?*SDL.SDL_Texture = null, // Streaming texture the framebuffer is uploaded to once per frame.
 
     pub fn init(comptime self: *Renderer) *Renderer {
         if (SDL.SDL_Init(SDL.SDL_INIT_VIDEO | SDL.SDL_INIT_AUDIO) < 0) {
@@ -97,31 +114,50 @@ pub const Renderer = struct {
             WindowSettings.sdl_flags,
         ) orelse utils.sdlPanic();
 
-        self.renderer = SDL.SDL_CreateRenderer(self.window, -1, SDL.SDL_RENDERER_ACCELERATED) orelse utils.sdlPanic();
+        // GPU-less machines may not have an accelerated renderer at all, and we only need one to present the framebuffer.
+        const renderer_flags = if (SOFTWARE_RENDERING) 0 else SDL.SDL_RENDERER_ACCELERATED;
+        self.renderer = SDL.SDL_CreateRenderer(self.window, -1, renderer_flags) orelse utils.sdlPanic();
 
         if (SDL.SDL_SetRenderDrawBlendMode(self.renderer, SDL.SDL_BLENDMODE_BLEND) < 0) {
             utils.sdlPanic();
         }
 
-        Textures.init(self, self.renderer);
-
-        utils.assert(Textures.map.cur_back_idx < Textures.map.cur_front_idx, "Can't loop through texture map if it's not full.");
+        if (SOFTWARE_RENDERING) {
+            self.framebuffer = software_render.Surface.init(std.heap.c_allocator, WindowSettings.width, WindowSettings.height);
+            self.framebuffer.fill(0xFF000000);
+            self.compositor.init(std.heap.c_allocator);
 
-        for (Textures.map.things) |textures| {
-            for (textures) |*texture| {
-                if (texture.ptr) |ptr| {
-                    if (SDL.SDL_SetTextureBlendMode(ptr, SDL.SDL_BLENDMODE_BLEND) < 0) {
-                        utils.sdlPanic();
-                    }
-                }
+            self.screen = SDL.SDL_CreateTexture(
+                self.renderer,
+                Textures.FORMAT,
+                SDL.SDL_TEXTUREACCESS_STREAMING,
+                WindowSettings.width,
+                WindowSettings.height,
+            ) orelse utils.sdlPanic();
+
+            if (SDL.SDL_SetTextureBlendMode(self.screen, SDL.SDL_BLENDMODE_NONE) < 0) {
+                utils.sdlPanic();
             }
         }
 
+        Textures.init(self);
+
         return self;
     }
 
     pub fn deinit(self: *Renderer) void {
-        Textures.deinit();
+        if (self.static_background) |ptr| {
+            SDL.SDL_DestroyTexture(ptr);
+        }
+        if (SOFTWARE_RENDERING) {
+            if (self.static_background_surface) |surface| {
+                surface.deinit(std.heap.c_allocator);
+            }
+            self.compositor.deinit();
+            self.framebuffer.deinit(std.heap.c_allocator);
+            SDL.SDL_DestroyTexture(self.screen);
+        }
+        Textures.deinit(self);
         _ = SDL.SDL_DestroyRenderer(self.renderer);
         SDL.SDL_DestroyWindow(self.window);
         SDL.SDL_Quit();
@@ -134,6 +170,9 @@ pub const Renderer = struct {
         dynamic_entities: *DynamicEntities,
         comptime slowdown_factor: float,
     ) !void {
+        const zone = profile.zone("draw_dynamic_entities");
+        defer zone.end();
+
         const N = DynamicEntities.NUM;
 
         for (
@@ -145,26 +184,21 @@ pub const Renderer = struct {
             const id = visual_assets.IDFromEntityMode(mode);
             if (id == .DONT_LOAD_TEXTURE) continue;
 
-            const textures = try Textures.map.lookup(id, false);
-            if (corrected_animation_counter(counter, slowdown_factor) < counter_correction) {
-                std.debug.print("\n\n{any}\n{any}\n\n", .{
-                    counter_correction,
-                    corrected_animation_counter(counter, slowdown_factor),
-                });
+            const textures = try Textures.lookupIfReady(self, id) orelse {
+                self.draw_placeholder(counter, id, x - @divExact(fullWidth(id), 2), y - @divExact(fullHeight(id), 2));
+                continue;
+            };
+            const corrected_counter = corrected_animation_counter(counter, slowdown_factor);
+            if (corrected_counter < counter_correction) {
+                std.log.warn("Animation counter {d} is behind its correction {d}.", .{ corrected_counter, counter_correction });
             }
-            const animation_counter = corrected_animation_counter(counter, slowdown_factor) - counter_correction;
+            const animation_counter = corrected_counter - counter_correction;
             const texture = textures[animation_counter % textures.len];
 
-            _ = SDL.SDL_RenderCopy(
-                self.renderer,
-                texture.ptr,
-                null,
-                &SDL.SDL_Rect{
-                    .x = x - @divExact(texture.width, 2),
-                    .y = y - @divExact(texture.height, 2),
-                    .w = texture.width,
-                    .h = texture.height,
-                },
+            self.copy_texture_at(
+                texture,
+                x - @divExact(texture.full_width, 2),
+                y - @divExact(texture.full_height, 2),
             );
         }
     }
@@ -175,6 +209,9 @@ pub const Renderer = struct {
         asset_ids: []const visual_assets.ID,
         comptime slowdown_factor: float,
     ) !void {
+        const zone = profile.zone("draw_looping_animations");
+        defer zone.end();
+
         for (asset_ids) |asset_id| {
             const animation_counter = corrected_animation_counter(counter, slowdown_factor);
             self.draw_animation_frame(animation_counter, asset_id) catch unreachable;
@@ -186,9 +223,14 @@ pub const Renderer = struct {
         frame_index: usize,
         asset_id: visual_assets.ID,
     ) !void {
-        const textures = try Textures.map.lookup(asset_id, false);
-        const texture = textures[frame_index % textures.len];
-        _ = SDL.SDL_RenderCopy(self.renderer, texture.ptr, null, null);
+        const zone = profile.zone("draw_animation_frame");
+        defer zone.end();
+
+        const textures = try Textures.lookupIfReady(self, asset_id) orelse {
+            self.draw_placeholder(frame_index, asset_id, 0, 0);
+            return;
+        };
+        self.draw_frame(textures, frame_index, asset_id, 0, 0);
     }
 
     pub fn draw_looping_animations_at(
@@ -199,6 +241,9 @@ pub const Renderer = struct {
         Y: []const i32,
         comptime slowdown_factor: float,
     ) !void {
+        const zone = profile.zone("draw_looping_animations_at");
+        defer zone.end();
+
         for (X, Y, asset_ids) |x, y, asset_id| {
             const animation_counter = corrected_animation_counter(counter, slowdown_factor);
             self.draw_animation_frame_at(animation_counter, asset_id, x, y) catch unreachable;
@@ -212,27 +257,228 @@ pub const Renderer = struct {
         x: i32,
         y: i32,
     ) !void {
-        const textures = try Textures.map.lookup(asset_id, false);
-        const texture = textures[frame_index % textures.len];
-
-        _ = SDL.SDL_RenderCopy(
-            self.renderer,
-            texture.ptr,
-            null,
-            &SDL.SDL_Rect{
-                .x = x,
-                .y = y,
-                .w = texture.width,
-                .h = texture.height,
-            },
+        const zone = profile.zone("draw_animation_frame_at");
+        defer zone.end();
+
+        const textures = try Textures.lookupIfReady(self, asset_id) orelse {
+            self.draw_placeholder(frame_index, asset_id, x, y);
+            return;
+        };
+        self.draw_frame(textures, frame_index, asset_id, x, y);
+    }
+
+    fn draw_frame(self: *Renderer, textures: []visual_assets.Texture, frame_index: usize, asset_id: visual_assets.ID, x: i32, y: i32) void {
+        const animation_frame = frame_index % textures.len;
+
+        Textures.showFrame(self, asset_id, animation_frame, x, y);
+        self.copy_texture_at(textures[animation_frame], x, y);
+    }
+
+    // True once the asset can be drawn. Until then, draw_* calls show the loading animation in its place.
+    pub fn asset_ready(self: *Renderer, asset_id: visual_assets.ID) bool {
+        _ = self;
+        return Textures.isResident(asset_id);
+    }
+
+    // The loading animation, centered on where the missing asset would be drawn. It is loaded before anything else,
+    // and never evicted.
+    fn draw_placeholder(self: *Renderer, frame_index: usize, asset_id: visual_assets.ID, x: i32, y: i32) void {
+        const loading_textures = (Textures.lookupIfReady(self, .UI_LOADING_ASSETS) catch unreachable) orelse return;
+        const texture = loading_textures[frame_index % loading_textures.len];
+
+        self.copy_texture_at(
+            texture,
+            x + @divFloor(fullWidth(asset_id) - texture.full_width, 2),
+            y + @divFloor(fullHeight(asset_id) - texture.full_height, 2),
         );
     }
 
+    // (x, y) is the top-left corner of the untrimmed frame.
+    // Full-screen assets are drawn at (0, 0), since they are authored at the window resolution.
+    fn copy_texture_at(self: *Renderer, texture: visual_assets.Texture, x: i32, y: i32) void {
+        if (SOFTWARE_RENDERING) {
+            self.compositor.push(self.framebuffer, textureImage(texture), x + texture.x_offset, y + texture.y_offset);
+        } else {
+            _ = SDL.SDL_RenderCopy(
+                self.renderer,
+                texture.ptr,
+                null,
+                &SDL.SDL_Rect{
+                    .x = x + texture.x_offset,
+                    .y = y + texture.y_offset,
+                    .w = texture.width,
+                    .h = texture.height,
+                },
+            );
+        }
+    }
+
+    // Flattens the leading single-frame background layers of a stage into one opaque render target,
+    // so each frame of a match pays for a single unblended copy instead of one full-screen blend per layer.
+    // Only a leading run is flattened, since an animated layer in between must still be drawn in order.
+    pub fn prepare_static_background(self: *Renderer, asset_ids: []const visual_assets.ID) void {
+        self.num_static_background_layers = 0;
+
+        var num_static_layers: usize = 0;
+        for (asset_ids) |asset_id| {
+            if (visual_assets.ASSETS_PER_ID[asset_id.int()] != 1) break;
+            num_static_layers += 1;
+        }
+
+        if (num_static_layers == 0) return;
+
+        if (SOFTWARE_RENDERING) {
+            self.prepare_static_background_surface(asset_ids[0..num_static_layers]);
+        } else {
+            if (!self.prepare_static_background_texture(asset_ids[0..num_static_layers])) return;
+        }
+
+        self.num_static_background_layers = num_static_layers;
+    }
+
+    fn prepare_static_background_surface(self: *Renderer, asset_ids: []const visual_assets.ID) void {
+        if (self.static_background_surface == null) {
+            self.static_background_surface = software_render.Surface.init(std.heap.c_allocator, WindowSettings.width, WindowSettings.height);
+        }
+        const surface = self.static_background_surface.?;
+
+        surface.fill(0xFF000000);
+
+        for (asset_ids) |asset_id| {
+            const textures = Textures.lookup(self, asset_id) catch unreachable;
+            surface.blit(textureImage(textures[0]), textures[0].x_offset, textures[0].y_offset);
+        }
+
+        // Same pixel pointer, new contents.
+        self.compositor.invalidate();
+    }
+
+    fn prepare_static_background_texture(self: *Renderer, asset_ids: []const visual_assets.ID) bool {
+        if (SDL.SDL_RenderTargetSupported(self.renderer) != SDL.SDL_TRUE) return false;
+
+        // Waits for every layer, since a placeholder drawn now would stay in the background for the whole match.
+        for (asset_ids) |asset_id| {
+            _ = Textures.lookup(self, asset_id) catch unreachable;
+        }
+
+        if (self.static_background == null) {
+            self.static_background = SDL.SDL_CreateTexture(
+                self.renderer,
+                Textures.FORMAT,
+                SDL.SDL_TEXTUREACCESS_TARGET,
+                WindowSettings.width,
+                WindowSettings.height,
+            ) orelse utils.sdlPanic();
+
+            if (SDL.SDL_SetTextureBlendMode(self.static_background, SDL.SDL_BLENDMODE_NONE) < 0) {
+                utils.sdlPanic();
+            }
+        }
+
+        if (SDL.SDL_SetRenderTarget(self.renderer, self.static_background) < 0) {
+            utils.sdlPanic();
+        }
+
+        // Blending the layers onto opaque black keeps the result opaque.
+        if (SDL.SDL_SetRenderDrawColor(self.renderer, 0x00, 0x00, 0x00, 0xFF) < 0) {
+            utils.sdlPanic();
+        }
+        if (SDL.SDL_RenderClear(self.renderer) < 0) {
+            utils.sdlPanic();
+        }
+
+        for (asset_ids) |asset_id| {
+            self.draw_animation_frame(0, asset_id) catch unreachable;
+        }
+
+        if (SDL.SDL_SetRenderTarget(self.renderer, null) < 0) {
+            utils.sdlPanic();
+        }
+
+        return true;
+    }
+
+    // Draws the background prepared by prepare_static_background(), followed by the remaining animated layers.
+    pub fn draw_stage_background(
+        self: *Renderer,
+        counter: usize,
+        asset_ids: []const visual_assets.ID,
+        comptime slowdown_factor: float,
+    ) !void {
+        const zone = profile.zone("draw_stage_background");
+        defer zone.end();
+
+        if (self.num_static_background_layers > 0) {
+            if (SOFTWARE_RENDERING) {
+                self.compositor.push(self.framebuffer, self.static_background_surface.?.image(true), 0, 0);
+            } else {
+                _ = SDL.SDL_RenderCopy(self.renderer, self.static_background, null, null);
+            }
+        }
+
+        try self.draw_looping_animations(counter, asset_ids[self.num_static_background_layers..], slowdown_factor);
+    }
+
+    // Starts loading a group in the background, so drawing it later doesn't stall.
+    pub fn prefetch_asset_group(self: *Renderer, group: visual_assets.Group) void {
+        Textures.prefetch(self, group);
+    }
+
+    // Loads a group now, blocking if needed.
+    pub fn require_asset_group(self: *Renderer, group: visual_assets.Group) void {
+        Textures.require(self, group);
+    }
+
     pub fn render(self: *Renderer) void {
+        const zone = profile.zone("render");
+        defer zone.end();
+
+        Textures.pump(self);
+
+        if (SOFTWARE_RENDERING) {
+            self.compositor.flush(self.framebuffer);
+
+            // Only upload the regions that were recomposited, none if nothing changed. The frame is still copied and
+            // presented, so presenting paces every frame the same way whether or not it changed.
+            var dirty_rects: [Compositor.MAX_DIRTY_RECTS]software_render.Rect = undefined;
+
+            for (self.compositor.dirtyRects(&dirty_rects)) |dirty_rect| {
+                const first_pixel: usize = @as(usize, @intCast(dirty_rect.y0)) * self.framebuffer.width + @as(usize, @intCast(dirty_rect.x0));
+
+                if (SDL.SDL_UpdateTexture(
+                    self.screen,
+                    &SDL.SDL_Rect{
+                        .x = dirty_rect.x0,
+                        .y = dirty_rect.y0,
+                        .w = dirty_rect.x1 - dirty_rect.x0,
+                        .h = dirty_rect.y1 - dirty_rect.y0,
+                    },
+                    &self.framebuffer.pixels[first_pixel],
+                    @intCast(self.framebuffer.width * @sizeOf(u32)),
+                ) < 0) {
+                    utils.sdlPanic();
+                }
+            }
+            _ = SDL.SDL_RenderCopy(self.renderer, self.screen, null, null);
+        }
         SDL.SDL_RenderPresent(self.renderer);
     }
 };
 
+fn textureImage(texture: visual_assets.Texture) software_render.Image {
+    const pixels: software_render.Image.Pixels = if (texture.indices) |indices|
+        .{ .indexed = .{ .indices = indices, .palette = texture.palette.? } }
+    else
+        .{ .rgba = texture.pixels.? };
+
+    return .{
+        .pixels = pixels,
+        .width = @intCast(texture.width),
+        .height = @intCast(texture.height),
+        .is_opaque = texture.is_opaque,
+    };
+}
+
 fn fillWithColor(renderer: *SDL.SDL_Renderer) void {
     if (SDL.SDL_SetRenderDrawColor(renderer, 0xF7, 0xA4, 0x1D, 0xFF) < 0) {
         utils.sdlPanic();
@@ -242,204 +488,884 @@ fn fillWithColor(renderer: *SDL.SDL_Renderer) void {
     }
 }
 
-fn count_assets_before(comptime id: visual_assets.ID) usize {
-    @setEvalBranchQuota(10000);
+// Index in visual_assets.ALL of the first asset of each ID.
+const FIRST_ASSET_PER_ID: [visual_assets.ID.size()]usize = first_asset_per_id: {
+    var first_asset: [visual_assets.ID.size()]usize = undefined;
     var count: usize = 0;
 
-    for (visual_assets.ASSETS_PER_ID[0..id.int()]) |num_assets| {
+    for (visual_assets.ASSETS_PER_ID, 0..) |num_assets, id_index| {
+        first_asset[id_index] = count;
         count += num_assets;
     }
 
-    return count;
+    break :first_asset_per_id first_asset;
+};
+
+fn textureOf(asset_index: usize) *visual_assets.Texture {
+    const id_index = visual_assets.ALL[asset_index].id.int();
+    return &visual_assets.texture_slices[id_index][asset_index - FIRST_ASSET_PER_ID[id_index]];
 }
 
-fn threadsafe_decode_pngs(
-    outputs: []rgbapng.Image,
-    num_assets: usize,
-    index_in_all: usize,
-    threadsafe_arena: *std.heap.ThreadSafeAllocator,
-) void {
-    std.debug.print("\nDecoding PNGs [{d}, {d}]", .{index_in_all, index_in_all + num_assets});
-    for (
-        0..num_assets,
-        visual_assets.ALL[index_in_all .. index_in_all + num_assets],
-    ) |local_index, visual_asset| {
+// Untrimmed size of the frames of an ID, known without loading them.
+fn fullWidth(id: visual_assets.ID) i32 {
+    return visual_assets.ALL[FIRST_ASSET_PER_ID[id.int()]].trim.full_width;
+}
+
+fn fullHeight(id: visual_assets.ID) i32 {
+    return visual_assets.ALL[FIRST_ASSET_PER_ID[id.int()]].trim.full_height;
+}
 
-        outputs[local_index] = rgbapng.decode(
-            .{ .optimistic = true },
-            visual_asset.path,
-            threadsafe_arena.allocator(),
-        ) catch unreachable;
+// Trimmed pixels of one frame, either in a decoded PNG or decompressed from the asset pack.
+const PixelSource = struct {
+    data: [*]const u8, // First pixel of the trimmed rectangle.
+    stride: usize,
+    palette: []const u32 = &.{}, // Only for frames stored indexed, whose data then has one byte per pixel.
 
+    fn isIndexed(self: PixelSource) bool {
+        return self.palette.len > 0;
     }
-}
 
+    // Unused entries are transparent black, so any index is safe to look up.
+    fn fullPalette(self: PixelSource) [256]u32 {
+        var palette: [256]u32 = .{0} ** 256;
+        @memcpy(palette[0..self.palette.len], self.palette);
+        return palette;
+    }
+};
+
+// Owns every texture, and keeps only some asset groups resident at a time.
+// Groups are loaded when first drawn (or earlier, when prefetched), and the least recently drawn ones
+// are evicted whenever a new group would take the total above TEXTURE_BUDGET_BYTES.
 pub const Textures = struct {
     const FORMAT: c_int = SDL.SDL_PIXELFORMAT_ABGR8888;
     const ACCESS_MODE: c_int = SDL.SDL_TEXTUREACCESS_STREAMING;
 
-    var map = utils.StaticMap(visual_assets.ID.size(), visual_assets.ID, []visual_assets.Texture);
+    const Group = visual_assets.Group;
+
+    const TEXTURE_BUDGET_BYTES: usize = @as(usize, @import("build_options").texture_budget_mb) << 20;
+
+    // Holds the placeholder drawn while other groups load, so it has to stay resident.
+    const PINNED_GROUP = visual_assets.GROUP_PER_ID[visual_assets.ID.UI_LOADING_ASSETS.int()];
+
+    // The least the stage selection menu needs to be usable. Startup blocks on these alone.
+    const STARTUP_GROUPS = [_]Group{ .UI_PLAYER, .MENU_WAITING };
+
+    // Streamed in the background once the menu is up, most likely to be drawn first.
+    // UI_PAUSED is left out: it's large, and prefetched when a match starts.
+    const STREAMED_GROUPS = [_]Group{
+        .STAGE_THUMBNAILS,
+        .UI_QUITTING,
+        .STAGE_METEOR,
+        .MENU_STAGE,
+        .CHARACTER_TEST,
+        .CHARACTER_WURMPLE,
+        .PROJECTILE_TEST,
+        .UI_AMMO,
+        .UI_HEALTH,
+        .STAGE_TEST00,
+    };
+
+    // Pixel memory of each group once uploaded, known at compile time from the trims. Duplicate frames take none.
+    // With an asset pack, delta encoded animations take less, see packedGroupBytes().
+    const GROUP_BYTES: [Group.size()]usize = group_bytes: {
+        @setEvalBranchQuota(100000);
+        var bytes: [Group.size()]usize = .{0} ** Group.size();
+
+        for (visual_assets.ALL) |asset| {
+            if (asset.duplicate_of != null) continue;
+            bytes[visual_assets.GROUP_PER_ID[asset.id.int()].int()] += @as(usize, asset.trim.width) * asset.trim.height * @sizeOf(u32);
+        }
 
-    pub fn init(
-        renderer: *Renderer,
-        sdl_renderer: *SDL.SDL_Renderer,
-    ) void {
-        var arena = std.heap.ArenaAllocator.init(std.heap.raw_c_allocator);
-        var threadsafe_arena = std.heap.ThreadSafeAllocator{ .child_allocator = arena.allocator() };
-        defer arena.deinit();
+        break :group_bytes bytes;
+    };
 
-        var assets_loaded: usize = 0;
+    const ASSETS_PER_GROUP: [Group.size()]usize = assets_per_group: {
+        var num_assets: [Group.size()]usize = .{0} ** Group.size();
+
+        for (visual_assets.GROUP_PER_ID, visual_assets.ASSETS_PER_ID) |group, num_id_assets| {
+            num_assets[group.int()] += num_id_assets;
+        }
+
+        break :assets_per_group num_assets;
+    };
+
+    const MAX_ASSETS_PER_GROUP = std.mem.max(usize, &ASSETS_PER_GROUP);
+
+    const MAX_CHUNKS_PER_GROUP = max_chunks_per_group: {
+        @setEvalBranchQuota(100000);
+        var num_chunks: [Group.size()]usize = .{0} ** Group.size();
+
+        // A delta encoded frame stores at most the whole canvas.
+        for (visual_assets.ALL) |asset| {
+            if (asset.duplicate_of != null) continue;
+            const stored = visual_assets.DELTA_CANVAS_PER_ID[asset.id.int()] orelse asset.trim;
+            num_chunks[visual_assets.GROUP_PER_ID[asset.id.int()].int()] += asset_pack.numChunks(@as(usize, stored.width) * stored.height * @sizeOf(u32));
+        }
+
+        break :max_chunks_per_group std.mem.max(usize, &num_chunks);
+    };
+
+    var pack: ?asset_pack.Pack = null;
+    var pool: work_pool.WorkStealingPool = undefined; // Decodes every group, from init() to deinit().
+    var group_bytes: [Group.size()]usize = GROUP_BYTES;
+
+    // Delta encoded animations, when loaded from the pack: the frame each canvas shows, and what each frame changes.
+    var canvas_frame: [visual_assets.ID.size()]usize = .{0} ** visual_assets.ID.size();
+    var deltas: [visual_assets.ALL.len]Delta = undefined;
+
+    const Delta = struct {
+        rect: asset_pack.Rect, // In the canvas.
+        pixels: []u32,
+        is_opaque: bool,
+    };
+
+    var resident: [Group.size()]bool = .{false} ** Group.size();
+    var last_used_frame: [Group.size()]u64 = .{0} ** Group.size();
+    var resident_bytes: usize = 0;
+    var frame: u64 = 1;
+
+    // One group at a time is prefetched: decoded by the pool, and uploaded a few frames at a time by pump().
+    var prefetch_load: GroupLoad = undefined;
+    var prefetching = false;
+    var pending_prefetches: std.BoundedArray(Group, Group.size()) = .{};
+
+    fn matchesPack(entry: asset_pack.Entry, visual_asset: visual_assets.Asset, asset_index: usize) bool {
+        const canvas = visual_assets.DELTA_CANVAS_PER_ID[visual_asset.id.int()] orelse {
+            return entry.width == visual_asset.trim.width and
+                entry.height == visual_asset.trim.height and
+                entry.isStored() == (visual_asset.duplicate_of == null);
+        };
+
+        const canvas_rect = asset_pack.Rect{ .width = canvas.width, .height = canvas.height };
+        const stored = if (asset_index == FIRST_ASSET_PER_ID[visual_asset.id.int()]) canvas_rect else entry.changed;
+
+        return entry.isStored() and
+            !entry.isIndexed() and
+            canvas_rect.contains(entry.changed) and
+            entry.width == stored.width and
+            entry.height == stored.height;
+    }
+
+    // Pixel memory of each group loaded from the pack. A delta encoded animation takes its canvas, its changed
+    // regions, and a copy of the region of its first frame that changes from the last.
+    // Indexed frames stay indexed only when compositing in software, GPU textures are always RGBA.
+    fn packedGroupBytes(opened_pack: asset_pack.Pack) [Group.size()]usize {
+        var bytes: [Group.size()]usize = .{0} ** Group.size();
+
+        for (opened_pack.entries, visual_assets.ALL, 0..) |entry, visual_asset, asset_index| {
+            if (!entry.isStored()) continue;
+
+            var asset_bytes = if (entry.isIndexed() and !SOFTWARE_RENDERING) entry.numPixels() * @sizeOf(u32) else entry.rawSize();
+
+            if (visual_assets.DELTA_CANVAS_PER_ID[visual_asset.id.int()] != null and asset_index == FIRST_ASSET_PER_ID[visual_asset.id.int()]) {
+                asset_bytes += @as(usize, entry.changed.width) * entry.changed.height * @sizeOf(u32);
+            }
+
+            bytes[visual_assets.GROUP_PER_ID[visual_asset.id.int()].int()] += asset_bytes;
+        }
+
+        return bytes;
+    }
+
+    pub fn init(renderer: *Renderer) void {
+        var timer = std.time.Timer.start() catch unreachable;
+
+        var exe_dir: ?std.fs.Dir = utils.openExeDir() catch null;
+        if (exe_dir) |*dir| {
+            pack = asset_pack.Pack.open(dir.*, VISUAL_ASSET_PACK_NAME, visual_assets.ALL.len);
+            dir.close();
+        }
+
+        if (pack) |opened_pack| {
+            for (opened_pack.entries, visual_assets.ALL, 0..) |entry, visual_asset, asset_index| {
+                if (!matchesPack(entry, visual_asset, asset_index)) {
+                    opened_pack.close();
+                    pack = null;
+                    break;
+                }
+            } else {
+                group_bytes = packedGroupBytes(opened_pack);
+            }
+        }
+
+        if (pack == null) std.log.warn("No usable {s} next to the executable, decoding PNGs instead.", .{VISUAL_ASSET_PACK_NAME});
+
+        pool.init();
 
         // First, load 'loading assets' animation.
-        const index_in_all_of_loading_assets: usize = count_assets_before(visual_assets.ID.UI_LOADING_ASSETS);
+        require(renderer, .UI_LOADING);
 
-        for (
-            visual_assets.texture_slices[visual_assets.ID.UI_LOADING_ASSETS.int()],
-            visual_assets.ALL[index_in_all_of_loading_assets .. index_in_all_of_loading_assets + visual_assets.ASSETS_PER_ID[visual_assets.ID.UI_LOADING_ASSETS.int()]],
-        ) |*texture, visual_asset| {
-            utils.assert(
-                visual_asset.id == visual_assets.ID.UI_LOADING_ASSETS,
-                "visual_assets.id != visual_assets.ID.UI_LOADING_ASSETS. This means code generation is not grouping assets, or our index computation is wrong.",
-            );
+        var num_startup_assets: usize = 0;
+        for (STARTUP_GROUPS) |group| {
+            num_startup_assets += ASSETS_PER_GROUP[group.int()];
+        }
+
+        var assets_loaded: usize = 0;
+
+        // Then, load what the menus need while displaying loading animation.
+        for (STARTUP_GROUPS) |group| {
+            const loading_textures = visual_assets.texture_slices[visual_assets.ID.UI_LOADING_ASSETS.int()];
+
+            renderer.draw_animation_frame_at(
+                utils.map_index_to_index(assets_loaded, num_startup_assets, loading_textures.len),
+                visual_assets.ID.UI_LOADING_ASSETS,
+                constants.X_RESOLUTION / 2 - @divFloor(loading_textures[0].full_width, 2),
+                constants.Y_RESOLUTION / 2 - @divFloor(loading_textures[0].full_height, 2),
+            ) catch unreachable;
+
+            renderer.render();
+
+            require(renderer, group);
+            assets_loaded += ASSETS_PER_GROUP[group.int()];
+        }
+
+        std.log.debug("Menu ready in {d} ms, streaming the other assets.", .{timer.read() / std.time.ns_per_ms});
+
+        // Only as much as fits in the budget, so streaming never evicts what it just loaded.
+        var streamed_bytes = resident_bytes;
+
+        for (STREAMED_GROUPS) |group| {
+            streamed_bytes += group_bytes[group.int()];
+            if (streamed_bytes > TEXTURE_BUDGET_BYTES) break;
+
+            prefetch(renderer, group);
+        }
+    }
+
+    pub fn deinit(renderer: *Renderer) void {
+        // Workers may be waiting for their frames to be uploaded, so an in-flight load is finished, not abandoned.
+        if (prefetching) {
+            prefetch_load.finish(renderer);
+            prefetching = false;
+        }
+
+        for (0..Group.size()) |group_index| {
+            if (resident[group_index]) releaseGroup(@enumFromInt(group_index));
+        }
+
+        pool.deinit();
+
+        if (pack) |opened_pack| opened_pack.close();
+    }
+
+    // Textures of an ID, loading its group first if it isn't resident.
+    pub fn lookup(renderer: *Renderer, id: visual_assets.ID) error{NotLoadable}![]visual_assets.Texture {
+        if (id == .DONT_LOAD_TEXTURE) return error.NotLoadable;
+
+        const group = visual_assets.GROUP_PER_ID[id.int()];
+
+        require(renderer, group);
+        last_used_frame[group.int()] = frame;
+
+        return visual_assets.texture_slices[id.int()];
+    }
+
+    // Textures of an ID if its group is resident. Otherwise moves the group to the front of the prefetch queue,
+    // and returns null so the caller can draw a placeholder instead of stalling the frame.
+    pub fn lookupIfReady(renderer: *Renderer, id: visual_assets.ID) error{NotLoadable}!?[]visual_assets.Texture {
+        if (id == .DONT_LOAD_TEXTURE) return error.NotLoadable;
+
+        const group = visual_assets.GROUP_PER_ID[id.int()];
+
+        if (!resident[group.int()]) {
+            prefetchFirst(renderer, group);
+            return null;
+        }
+
+        last_used_frame[group.int()] = frame;
+
+        return visual_assets.texture_slices[id.int()];
+    }
+
+    pub fn isResident(id: visual_assets.ID) bool {
+        return resident[visual_assets.GROUP_PER_ID[id.int()].int()];
+    }
+
+    // Blocks until the group is resident.
+    pub fn require(renderer: *Renderer, group: Group) void {
+        if (resident[group.int()]) return;
+
+        // The pool runs one load at a time, so the one in flight is finished first.
+        if (prefetching) {
+            const prefetched_group = prefetch_load.group;
+
+            prefetch_load.finish(renderer);
+            prefetching = false;
+
+            if (prefetched_group == group) {
+                startNextPrefetch(renderer);
+                return;
+            }
+        }
+
+        var load: GroupLoad = undefined;
+        load.start(renderer, group);
+        load.finish(renderer);
+
+        startNextPrefetch(renderer);
+    }
+
+    // Starts loading the group in the background, if it isn't resident or already on its way.
+    pub fn prefetch(renderer: *Renderer, group: Group) void {
+        if (resident[group.int()] or group == .DONT_LOAD) return;
+        if (prefetching and prefetch_load.group == group) return;
+        if (std.mem.indexOfScalar(Group, pending_prefetches.slice(), group) != null) return;
+
+        pending_prefetches.append(group) catch unreachable;
+
+        if (!prefetching) startNextPrefetch(renderer);
+    }
+
+    // Like prefetch(), but ahead of every other pending group.
+    fn prefetchFirst(renderer: *Renderer, group: Group) void {
+        if (prefetching and prefetch_load.group == group) return;
+
+        if (std.mem.indexOfScalar(Group, pending_prefetches.slice(), group)) |index| {
+            _ = pending_prefetches.orderedRemove(index);
+        }
+
+        pending_prefetches.insert(0, group) catch unreachable;
+
+        if (!prefetching) startNextPrefetch(renderer);
+    }
+
+    // Called once per frame. Uploads the prefetched frames decoded since the last call, and marks the end of the frame for the LRU.
+    pub fn pump(renderer: *Renderer) void {
+        if (prefetching) {
+            prefetch_load.uploadArrived(renderer);
+
+            if (prefetch_load.allUploaded()) {
+                prefetch_load.finish(renderer);
+                prefetching = false;
+                startNextPrefetch(renderer);
+            }
+        }
+
+        frame += 1;
+    }
+
+    fn startNextPrefetch(renderer: *Renderer) void {
+        while (pending_prefetches.len > 0) {
+            const group = pending_prefetches.orderedRemove(0);
+            if (resident[group.int()]) continue;
+
+            prefetch_load.start(renderer, group);
+            prefetching = true;
+            return;
+        }
+    }
+
+    // One decoded (or decompressed) frame on its way from a worker to the main thread.
+    // It owns its pixels, in an arena of its own, which is freed as soon as the frame is uploaded. A per-worker arena
+    // could only be freed once the whole group is uploaded, and would hold every frame its worker decoded until then.
+    const DecodedAsset = struct {
+        asset_index: usize,
+        arena: std.heap.ArenaAllocator,
+        source: PixelSource,
+        // Asset pack only.
+        pixels: []u8, // Chunks are decompressed in place, once the asset's turn to get a buffer has come.
+        allocation_order: usize,
+        allocated: std.atomic.Value(bool),
+        chunks_left: std.atomic.Value(usize), // The worker decompressing the last chunk queues the asset.
+    };
+
+    const DecodedQueue = mpsc_queue.MpscQueue(DecodedAsset);
+
+    // Loads one group as a pipeline: workers decode its frames in parallel and queue each one as soon as it's done,
+    // and the main thread uploads and frees them as they arrive, so uploading overlaps decoding and the decoded
+    // pixels of the whole group are never held at once.
+    // The work is split into tasks (chunks or whole PNGs) that run largest first on the pool, so the main thread
+    // is free to upload, or to keep drawing frames while prefetching.
+    const GroupLoad = struct {
+        group: Group,
+        queue: DecodedQueue,
+        arrived: std.Thread.Semaphore, // Posted once per queued frame.
+        // Frames decoded, or with a buffer to be decompressed into, that wait for their upload. Bounds peak memory,
+        // however large the group and however slow the uploader.
+        decoded_slots: std.Thread.Semaphore,
+        num_assets: usize,
+        num_uploaded: usize,
+        png_tasks: [MAX_ASSETS_PER_GROUP]PngTask,
+        chunk_tasks: [MAX_CHUNKS_PER_GROUP]ChunkTask,
+        num_chunk_tasks: usize,
+        // Asset pack only. Buffers are allocated in the order the chunk tasks first need them, see allocateUpTo.
+        allocation_mutex: std.Thread.Mutex,
+        assets_by_allocation: [MAX_ASSETS_PER_GROUP]*DecodedQueue.Node,
+        num_allocated: usize,
+        batch: union(enum) { png: PngDecoder, chunk: ChunkDecompressor },
+
+        const PngTask = struct {
+            asset_index: usize,
+
+            // Decoding time follows the size of the whole frame, not the trimmed one.
+            fn largerFirst(_: void, a: PngTask, b: PngTask) bool {
+                const trim_a = visual_assets.ALL[a.asset_index].trim;
+                const trim_b = visual_assets.ALL[b.asset_index].trim;
+                return @as(usize, trim_a.full_width) * trim_a.full_height > @as(usize, trim_b.full_width) * trim_b.full_height;
+            }
+        };
+
+        const ChunkTask = struct {
+            asset: *DecodedQueue.Node,
+            chunk_index: usize,
+            asset_size: usize, // Of all trimmed pixels of the asset.
+
+            // Larger assets first, and the chunks of one asset together, so assets complete (and upload) one after another.
+            fn largerFirst(_: void, a: ChunkTask, b: ChunkTask) bool {
+                if (a.asset_size != b.asset_size) return a.asset_size > b.asset_size;
+                if (a.asset != b.asset) return a.asset.value.asset_index < b.asset.value.asset_index;
+                return a.chunk_index < b.chunk_index;
+            }
+        };
+
+        const PngDecoder = work_pool.WorkStealingBatch(PngTask, *GroupLoad, decodePng);
+        const ChunkDecompressor = work_pool.WorkStealingBatch(ChunkTask, *GroupLoad, decompressChunk);
+
+        // Makes room for the group and starts decoding it. self must not move until finish().
+        fn start(self: *GroupLoad, renderer: *Renderer, group: Group) void {
+            makeRoom(renderer, group_bytes[group.int()]);
+            resident_bytes += group_bytes[group.int()];
+
+            var asset_indices_buffer: [MAX_ASSETS_PER_GROUP]usize = undefined;
+            const asset_indices = groupAssets(group, &asset_indices_buffer);
+
+            self.* = .{
+                .group = group,
+                .queue = .{},
+                .arrived = .{},
+                .decoded_slots = .{ .permits = 2 * pool.num_workers },
+                .num_assets = asset_indices.len,
+                .num_uploaded = 0,
+                .png_tasks = undefined,
+                .chunk_tasks = undefined,
+                .num_chunk_tasks = 0,
+                .allocation_mutex = .{},
+                .assets_by_allocation = undefined,
+                .num_allocated = 0,
+                .batch = undefined,
+            };
+
+            if (pack) |opened_pack| {
+                for (asset_indices) |asset_index| {
+                    const entry = opened_pack.entries[asset_index];
+                    const asset = newDecodedAsset(asset_index);
+
+                    asset.value.chunks_left = std.atomic.Value(usize).init(entry.num_chunks);
+
+                    for (0..entry.num_chunks) |chunk_index| {
+                        self.chunk_tasks[self.num_chunk_tasks] = .{ .asset = asset, .chunk_index = chunk_index, .asset_size = entry.rawSize() };
+                        self.num_chunk_tasks += 1;
+                    }
+                }
+
+                std.sort.pdq(ChunkTask, self.chunk_tasks[0..self.num_chunk_tasks], {}, ChunkTask.largerFirst);
+
+                // The chunks of an asset are next to each other, so its first one decides its turn.
+                var num_ordered: usize = 0;
+                for (self.chunk_tasks[0..self.num_chunk_tasks]) |task| {
+                    if (task.chunk_index != 0) continue;
+
+                    task.asset.value.allocation_order = num_ordered;
+                    self.assets_by_allocation[num_ordered] = task.asset;
+                    num_ordered += 1;
+                }
+
+                self.batch = .{ .chunk = ChunkDecompressor.init(&pool, self.chunk_tasks[0..self.num_chunk_tasks], self) };
+                pool.start(&self.batch.chunk);
+            } else {
+                for (asset_indices, self.png_tasks[0..asset_indices.len]) |asset_index, *task| {
+                    task.* = .{ .asset_index = asset_index };
+                }
+
+                std.sort.pdq(PngTask, self.png_tasks[0..asset_indices.len], {}, PngTask.largerFirst);
+
+                self.batch = .{ .png = PngDecoder.init(&pool, self.png_tasks[0..asset_indices.len], self) };
+                pool.start(&self.batch.png);
+            }
+        }
+
+        fn newDecodedAsset(asset_index: usize) *DecodedQueue.Node {
+            const asset = std.heap.c_allocator.create(DecodedQueue.Node) catch unreachable;
+
+            asset.* = .{ .value = .{
+                .asset_index = asset_index,
+                .arena = std.heap.ArenaAllocator.init(std.heap.raw_c_allocator),
+                .source = undefined,
+                .pixels = &.{},
+                .allocation_order = 0,
+                .allocated = std.atomic.Value(bool).init(false),
+                .chunks_left = std.atomic.Value(usize).init(0),
+            } };
+
+            return asset;
+        }
+
+        // Gives buffers to every asset up to the given one in allocation order, each once a decoded slot is free.
+        // Going in order keeps it from deadlocking: whoever waits here needs a later asset than all the ones holding
+        // a slot, and the chunks of those are either running or at the front of a queue whose worker isn't waiting.
+        fn allocateUpTo(self: *GroupLoad, allocation_order: usize) void {
+            self.allocation_mutex.lock();
+            defer self.allocation_mutex.unlock();
+
+            while (self.num_allocated <= allocation_order) : (self.num_allocated += 1) {
+                const asset = self.assets_by_allocation[self.num_allocated];
+                const entry = pack.?.entries[asset.value.asset_index];
+
+                self.decoded_slots.wait();
+
+                const pixels = asset.value.arena.allocator().alignedAlloc(u8, @alignOf(u32), entry.rawSize()) catch unreachable;
+
+                if (entry.isIndexed()) {
+                    const palette_bytes = @as(usize, entry.palette_size) * @sizeOf(u32);
+
+                    asset.value.source = .{
+                        .data = pixels.ptr + palette_bytes,
+                        .stride = entry.width,
+                        .palette = std.mem.bytesAsSlice(u32, pixels[0..palette_bytes]),
+                    };
+                } else {
+                    asset.value.source = .{ .data = pixels.ptr, .stride = @as(usize, entry.width) * @sizeOf(u32) };
+                }
+                asset.value.pixels = pixels;
+
+                // Release, so a worker that sees it allocated without the mutex also sees its buffer.
+                asset.value.allocated.store(true, .release);
+            }
+        }
+
+        fn queueDecoded(self: *GroupLoad, asset: *DecodedQueue.Node) void {
+            self.queue.push(asset);
+            self.arrived.post();
+        }
+
+        fn decodePng(self: *GroupLoad, task: PngTask, worker: usize) void {
+            _ = worker;
+            self.decoded_slots.wait();
+
+            const asset = newDecodedAsset(task.asset_index);
+            const visual_asset = visual_assets.ALL[task.asset_index];
+            const trim = visual_asset.trim;
 
             const image = rgbapng.decode(
                 .{ .optimistic = true },
                 visual_asset.path,
-                threadsafe_arena.allocator(),
+                asset.value.arena.allocator(),
             ) catch unreachable;
 
-            loadTexture(
-                sdl_renderer,
-                image,
-                texture,
-                FORMAT,
-                ACCESS_MODE,
-            ) catch unreachable;
+            utils.assert(
+                image.width == trim.full_width and image.height == trim.full_height,
+                "PNG size does not match its trim. This means visual_assets.zig is out of date.",
+            );
+
+            asset.value.source = .{
+                .data = image.data.ptr + trim.y * image.stride + @as(usize, trim.x) * @sizeOf(u32),
+                .stride = image.stride,
+            };
 
-            assets_loaded += 1;
+            self.queueDecoded(asset);
         }
 
-        map.insert(visual_assets.ID.UI_LOADING_ASSETS, visual_assets.texture_slices[visual_assets.ID.UI_LOADING_ASSETS.int()], false) catch unreachable;
+        fn decompressChunk(self: *GroupLoad, task: ChunkTask, worker: usize) void {
+            _ = worker;
+            const asset = task.asset;
 
-        renderer.draw_animation_frame_at(
-            utils.map_index_to_index(assets_loaded, visual_assets.ALL.len, visual_assets.ASSETS_PER_ID[visual_assets.ID.UI_LOADING_ASSETS.int()]),
-            visual_assets.ID.UI_LOADING_ASSETS,
-            constants.X_RESOLUTION / 2 - @divFloor(visual_assets.texture_slices[visual_assets.ID.UI_LOADING_ASSETS.int()][0].width, 2),
-            constants.Y_RESOLUTION / 2 - @divFloor(visual_assets.texture_slices[visual_assets.ID.UI_LOADING_ASSETS.int()][0].height, 2),
-        ) catch unreachable;
+            if (!asset.value.allocated.load(.acquire)) self.allocateUpTo(asset.value.allocation_order);
 
-        renderer.render();
+            pack.?.decompressChunk(asset.value.asset_index, task.chunk_index, asset.value.pixels) catch utils.assert(false, "Corrupt chunk in asset pack.");
 
-        // Then, load all other assets while displaying loading animation.
-        var images: [visual_assets.ALL.len]rgbapng.Image = undefined; // Just making it the full size for simplicity.
-        var threads: [visual_assets.ID.size() - 2]std.Thread = undefined;
-        var thread_index: usize = 0;
+            // acq_rel, so the uploader sees the chunks written by the other workers too.
+            if (asset.value.chunks_left.fetchSub(1, .acq_rel) == 1) self.queueDecoded(asset);
+        }
 
-        // Decode PNGs in parallel.
-        inline for (
-            std.meta.fields(visual_assets.ID),
-            visual_assets.ASSETS_PER_ID,
-        ) |enum_field, num_assets| {
-            const id: visual_assets.ID = comptime @enumFromInt(enum_field.value);
+        // Main thread only. Uploads every frame queued so far, freeing its pixels right away.
+        fn uploadArrived(self: *GroupLoad, renderer: *Renderer) void {
+            while (self.queue.pop()) |asset| {
+                const asset_index = asset.value.asset_index;
+                const visual_asset = visual_assets.ALL[asset_index];
+
+                if (isDeltaLoaded(visual_asset.id)) {
+                    uploadDeltaFrame(renderer, asset_index, asset.value.source);
+                } else {
+                    loadTexture(
+                        renderer.renderer,
+                        asset.value.source,
+                        visual_asset.trim,
+                        textureOf(asset_index),
+                        FORMAT,
+                        ACCESS_MODE,
+                    );
+                }
 
-            comptime if (id == .DONT_LOAD_TEXTURE or id == .UI_LOADING_ASSETS) {
-                continue;
-            };
+                asset.value.arena.deinit();
+                std.heap.c_allocator.destroy(asset);
 
-            const index_in_all = comptime count_assets_before(id);
+                self.decoded_slots.post();
+                self.num_uploaded += 1;
+            }
+        }
 
-            threads[thread_index] = std.Thread.spawn(.{}, threadsafe_decode_pngs, .{
-                images[index_in_all..index_in_all + num_assets],
-                num_assets,
-                index_in_all,
-                &threadsafe_arena,
-            }) catch unreachable;
+        fn allUploaded(self: *const GroupLoad) bool {
+            return self.num_uploaded == self.num_assets;
+        }
 
-            thread_index += 1;
+        // Main thread only. Blocks until the whole group is uploaded, and makes it resident.
+        fn finish(self: *GroupLoad, renderer: *Renderer) void {
+            self.uploadArrived(renderer);
 
+            // Every wait is matched by a frame still to be queued, so this can't wait forever.
+            while (!self.allUploaded()) {
+                self.arrived.wait();
+                self.uploadArrived(renderer);
+            }
+
+            pool.wait();
+
+            shareDuplicateTextures(self.group);
+            shareDeltaCanvases(self.group);
+
+            resident[self.group.int()] = true;
+            last_used_frame[self.group.int()] = frame;
         }
+    };
 
-        thread_index = 0;
+    // Indices in visual_assets.ALL of the assets in the group that have pixels of their own, in order.
+    fn groupAssets(group: Group, buffer: *[MAX_ASSETS_PER_GROUP]usize) []usize {
+        var num_assets: usize = 0;
 
-        inline for (
-            std.meta.fields(visual_assets.ID),
-            visual_assets.ASSETS_PER_ID,
-        ) |enum_field, num_assets| {
-            const id: visual_assets.ID = comptime @enumFromInt(enum_field.value);
+        for (visual_assets.GROUP_PER_ID, visual_assets.ASSETS_PER_ID, 0..) |id_group, num_id_assets, id_index| {
+            if (id_group != group) continue;
 
-            comptime if (id == .DONT_LOAD_TEXTURE or id == .UI_LOADING_ASSETS) {
-                continue;
-            };
+            for (FIRST_ASSET_PER_ID[id_index]..FIRST_ASSET_PER_ID[id_index] + num_id_assets) |asset_index| {
+                if (visual_assets.ALL[asset_index].duplicate_of != null) continue;
 
-            threads[thread_index].join();
-            thread_index += 1;
+                buffer[num_assets] = asset_index;
+                num_assets += 1;
+            }
+        }
 
-            const index_in_all = comptime count_assets_before(id);
+        return buffer[0..num_assets];
+    }
 
-            for (
-                visual_assets.texture_slices[id.int()],
-                visual_assets.ALL[index_in_all .. index_in_all + num_assets],
-                images[index_in_all .. index_in_all + num_assets],
-            ) |*texture, visual_asset, image| {
-                utils.assert(
-                    visual_asset.id == id,
-                    "visual_assets.id != id. This means code generation is not grouping assets, or our index computation is wrong.",
-                );
+    // Duplicate frames are never loaded. They get a copy of their original's Texture, so both draw the same SDL texture.
+    fn shareDuplicateTextures(group: Group) void {
+        for (visual_assets.ALL, 0..) |visual_asset, asset_index| {
+            const original = visual_asset.duplicate_of orelse continue;
+            if (visual_assets.GROUP_PER_ID[visual_asset.id.int()] != group) continue;
+
+            textureOf(asset_index).* = textureOf(original).*;
+        }
+    }
+
+    fn isDeltaLoaded(id: visual_assets.ID) bool {
+        return pack != null and visual_assets.DELTA_CANVAS_PER_ID[id.int()] != null;
+    }
+
+    // The first frame becomes the canvas texture. Every frame keeps the pixels of the region it changes in a CPU-side
+    // Delta. For the first frame, that's the region that differs from the last one, copied out of the canvas.
+    fn uploadDeltaFrame(renderer: *Renderer, asset_index: usize, source: PixelSource) void {
+        const id = visual_assets.ALL[asset_index].id;
+        const changed = pack.?.entries[asset_index].changed;
+        var region = source;
+
+        if (asset_index == FIRST_ASSET_PER_ID[id.int()]) {
+            loadTexture(renderer.renderer, source, visual_assets.DELTA_CANVAS_PER_ID[id.int()].?, textureOf(asset_index), FORMAT, ACCESS_MODE);
+            region.data += changed.y * source.stride + @as(usize, changed.x) * @sizeOf(u32);
+        }
+
+        const pixels = std.heap.c_allocator.alloc(u32, @as(usize, changed.width) * changed.height) catch unreachable;
+        copyPixels(region, changed.width, changed.height, @intFromPtr(pixels.ptr), @as(usize, changed.width) * @sizeOf(u32));
+
+        deltas[asset_index] = .{
+            .rect = changed,
+            .pixels = pixels,
+            .is_opaque = SOFTWARE_RENDERING and software_render.isOpaque(pixels),
+        };
+    }
+
+    // Every frame of a delta encoded animation draws the canvas, which showFrame() keeps on the right frame.
+    fn shareDeltaCanvases(group: Group) void {
+        for (visual_assets.GROUP_PER_ID, visual_assets.ASSETS_PER_ID, 0..) |id_group, num_assets, id_index| {
+            const id: visual_assets.ID = @enumFromInt(id_index);
+            if (id_group != group or !isDeltaLoaded(id)) continue;
 
-                loadTexture(
-                    sdl_renderer,
-                    image,
-                    texture,
-                    FORMAT,
-                    ACCESS_MODE,
-                ) catch unreachable;
+            const first_asset = FIRST_ASSET_PER_ID[id_index];
+            const canvas = textureOf(first_asset);
 
-                assets_loaded += 1;
+            // Frames may bring transparency into an opaque first frame.
+            for (deltas[first_asset..][0..num_assets]) |delta| {
+                if (!delta.is_opaque) canvas.is_opaque = false;
             }
 
-            if (id != .UI_LOADING_ASSETS) {
-                renderer.draw_animation_frame_at(
-                    utils.map_index_to_index(assets_loaded, visual_assets.ALL.len, visual_assets.ASSETS_PER_ID[visual_assets.ID.UI_LOADING_ASSETS.int()]),
-                    visual_assets.ID.UI_LOADING_ASSETS,
-                    constants.X_RESOLUTION / 2 - @divFloor(visual_assets.texture_slices[visual_assets.ID.UI_LOADING_ASSETS.int()][0].width, 2),
-                    constants.Y_RESOLUTION / 2 - @divFloor(visual_assets.texture_slices[visual_assets.ID.UI_LOADING_ASSETS.int()][0].height, 2),
-                ) catch unreachable;
+            for (visual_assets.texture_slices[id_index]) |*texture| {
+                texture.* = canvas.*;
+            }
+
+            canvas_frame[id_index] = 0;
+        }
+    }
+
+    // Steps the canvas of a delta encoded animation forward to the frame, uploading only the regions that change
+    // on the way. (x, y) is where the canvas is drawn this frame.
+    pub fn showFrame(renderer: *Renderer, id: visual_assets.ID, animation_frame: usize, x: i32, y: i32) void {
+        if (!isDeltaLoaded(id)) return;
+
+        const first_asset = FIRST_ASSET_PER_ID[id.int()];
+        const canvas = textureOf(first_asset).*;
+
+        while (canvas_frame[id.int()] != animation_frame) {
+            const next_frame = (canvas_frame[id.int()] + 1) % visual_assets.ASSETS_PER_ID[id.int()];
+            const delta = deltas[first_asset + next_frame];
+
+            canvas_frame[id.int()] = next_frame;
+
+            if (delta.rect.width == 0 or delta.rect.height == 0) continue;
+
+            if (SOFTWARE_RENDERING) {
+                const canvas_width: usize = @intCast(canvas.width);
 
-                renderer.render();
+                copyPixels(
+                    .{ .data = @ptrCast(delta.pixels.ptr), .stride = @as(usize, delta.rect.width) * @sizeOf(u32) },
+                    delta.rect.width,
+                    delta.rect.height,
+                    @intFromPtr(canvas.pixels.? + delta.rect.y * canvas_width + delta.rect.x),
+                    canvas_width * @sizeOf(u32),
+                );
 
-                map.insert(id, visual_assets.texture_slices[id.int()], false) catch unreachable;
+                // The canvas keeps its pixel pointer, so the compositor must be told which tiles changed.
+                const x0 = x + canvas.x_offset + delta.rect.x;
+                const y0 = y + canvas.y_offset + delta.rect.y;
+                renderer.compositor.invalidateRect(.{ .x0 = x0, .y0 = y0, .x1 = x0 + delta.rect.width, .y1 = y0 + delta.rect.height });
+            } else if (SDL.SDL_UpdateTexture(
+                canvas.ptr,
+                &SDL.SDL_Rect{ .x = delta.rect.x, .y = delta.rect.y, .w = delta.rect.width, .h = delta.rect.height },
+                delta.pixels.ptr,
+                @as(c_int, delta.rect.width) * @sizeOf(u32),
+            ) < 0) {
+                utils.sdlPanic();
             }
         }
+    }
+
+    // Evicts least recently drawn groups until the new group fits. Groups drawn this frame and PINNED_GROUP are never
+    // evicted, so if those alone exceed the budget we go over it rather than pull textures from under the frame.
+    fn makeRoom(renderer: *Renderer, new_bytes: usize) void {
+        while (resident_bytes + new_bytes > TEXTURE_BUDGET_BYTES) {
+            var least_recently_used: ?usize = null;
+
+            for (resident, last_used_frame, 0..) |is_resident, last_used, group_index| {
+                if (!is_resident or last_used == frame or group_index == PINNED_GROUP.int()) continue;
+                if (least_recently_used == null or last_used < last_used_frame[least_recently_used.?]) {
+                    least_recently_used = group_index;
+                }
+            }
 
-        map.insert(visual_assets.ID.DONT_LOAD_TEXTURE, visual_assets.texture_slices[visual_assets.ID.DONT_LOAD_TEXTURE.int()], false) catch unreachable;
+            const group_index = least_recently_used orelse break;
+
+            std.log.debug("Evicting texture group {s}", .{@tagName(@as(Group, @enumFromInt(group_index)))});
+            releaseGroup(@enumFromInt(group_index));
+
+            // Freed pixel memory may be handed out again for different pixels, so the compositor can't trust its tile hashes.
+            if (SOFTWARE_RENDERING) renderer.compositor.invalidate();
+        }
     }
 
-    pub fn deinit() void {
-        for (map.things) |textures| {
-            for (textures) |texture| {
-                SDL.SDL_DestroyTexture(texture.ptr);
+    fn releaseGroup(group: Group) void {
+        for (visual_assets.GROUP_PER_ID, 0..) |id_group, id_index| {
+            if (id_group != group) continue;
+
+            const delta_loaded = isDeltaLoaded(@enumFromInt(id_index));
+
+            for (visual_assets.texture_slices[id_index], FIRST_ASSET_PER_ID[id_index]..) |*texture, asset_index| {
+                if (delta_loaded) std.heap.c_allocator.free(deltas[asset_index].pixels);
+
+                // A duplicate's texture belongs to its original, and a delta encoded animation's canvas to its first frame.
+                const owns_texture = visual_assets.ALL[asset_index].duplicate_of == null and
+                    (!delta_loaded or asset_index == FIRST_ASSET_PER_ID[id_index]);
+
+                if (owns_texture) {
+                    if (texture.ptr) |ptr| {
+                        SDL.SDL_DestroyTexture(ptr);
+                    }
+                    if (texture.pixels) |pixels| {
+                        std.heap.c_allocator.free(pixels[0..@intCast(texture.width * texture.height)]);
+                    }
+                    if (texture.indices) |indices| {
+                        std.heap.c_allocator.free(indices[0..@intCast(texture.width * texture.height)]);
+                        std.heap.c_allocator.destroy(texture.palette.?);
+                    }
+                }
+                texture.ptr = null;
+                texture.pixels = null;
+                texture.indices = null;
+                texture.palette = null;
             }
         }
+
+        resident[group.int()] = false;
+        resident_bytes -= group_bytes[group.int()];
     }
 };
 
 fn loadTexture(
     renderer: *SDL.SDL_Renderer,
-    image: rgbapng.Image,
+    source: PixelSource,
+    trim: visual_assets.Trim,
     texture: *visual_assets.Texture,
     comptime format: c_int,
     comptime access_mode: c_int,
-) PngDecodeError!void {
+) void {
+    // Only the non-transparent part of the frame is kept, the offsets put it back in place when drawing.
+    texture.width = trim.width;
+    texture.height = trim.height;
+    texture.x_offset = trim.x;
+    texture.y_offset = trim.y;
+    texture.full_width = trim.full_width;
+    texture.full_height = trim.full_height;
+    texture.pixels = null;
+    texture.indices = null;
+    texture.palette = null;
+    texture.is_opaque = false;
+
+    // In software we composite from a CPU-side copy, and never create an SDL texture for the asset.
+    // Indexed frames stay indexed, at a quarter of the memory, and are expanded as they are blitted.
+    if (SOFTWARE_RENDERING and source.isIndexed()) {
+        const indices = std.heap.c_allocator.alloc(u8, @as(usize, trim.width) * trim.height) catch unreachable;
+        const palette = std.heap.c_allocator.create([256]u32) catch unreachable;
+
+        for (0..trim.height) |row| {
+            @memcpy(indices[row * trim.width ..][0..trim.width], source.data[row * source.stride ..][0..trim.width]);
+        }
+        palette.* = source.fullPalette();
+
+        texture.ptr = null;
+        texture.indices = indices.ptr;
+        texture.palette = palette;
+        texture.is_opaque = software_render.isOpaque(source.palette);
+        return;
+    }
+
+    if (SOFTWARE_RENDERING) {
+        const pixels = std.heap.c_allocator.alloc(u32, @as(usize, trim.width) * trim.height) catch unreachable;
+
+        copyPixels(source, trim.width, trim.height, @intFromPtr(pixels.ptr), @as(usize, trim.width) * @sizeOf(u32));
+
+        texture.ptr = null;
+        texture.pixels = pixels.ptr;
+        texture.is_opaque = software_render.isOpaque(pixels);
+        return;
+    }
+
     texture.ptr = SDL.SDL_CreateTexture(
         renderer,
         format,
         access_mode,
-        @intCast(image.width),
-        @intCast(image.height),
+        trim.width,
+        trim.height,
     ) orelse utils.sdlPanic();
 
-    texture.width = @intCast(image.width);
-    texture.height = @intCast(image.height);
+    if (SDL.SDL_SetTextureBlendMode(texture.ptr, SDL.SDL_BLENDMODE_BLEND) < 0) {
+        utils.sdlPanic();
+    }
 
     var pixels: ?*c_int = undefined;
     var stride: c_int = undefined;
@@ -455,7 +1381,9 @@ fn loadTexture(
     const start_addr_gpu = @intFromPtr(@as(*u8, @ptrCast(pixels_ptr[0].?)));
 
     copyPixels(
-        image,
+        source,
+        trim.width,
+        trim.height,
         start_addr_gpu,
         stride_gpu,
     );
@@ -468,20 +1396,66 @@ fn readPng(path: []const u8, allocator: std.mem.Allocator) PngDecodeError!rgbapn
 }
 
 fn copyPixels(
-    image: rgbapng.Image,
+    source: PixelSource,
+    width: usize,
+    height: usize,
     start_addr_dest: usize,
     stride_dest: usize,
 ) void {
-    for (0..image.height) |row| {
+    // SDL renderers can't sample paletted textures, so indexed frames are expanded on the way.
+    if (source.isIndexed()) {
+        const palette = source.fullPalette();
+
+        for (0..height) |row| {
+            const ptr_dest = @as([*]u32, @ptrFromInt(start_addr_dest + row * stride_dest));
+            software_render.expandIndexedRow(ptr_dest[0..width], source.data[row * source.stride ..][0..width], &palette);
+        }
+        return;
+    }
+
+    for (0..height) |row| {
         // const src_row_addr = start_addr_src + row * stride_src;
         const dest_row_addr = start_addr_dest + row * stride_dest;
 
         // const ptr_src = @as([*]u32, @ptrFromInt(src_row_addr));
-        const ptr_src = @as([*]u32, @ptrCast(@alignCast(@constCast(&image.data[row * image.stride]))));
+        const ptr_src = @as([*]const u32, @ptrCast(@alignCast(source.data + row * source.stride)));
         var ptr_dest = @as([*]u32, @ptrFromInt(dest_row_addr));
 
-        for (0..image.width) |col| {
+        for (0..width) |col| {
             ptr_dest[col] = ptr_src[col];
         }
     }
 }
+
+test "Evicting everything else keeps the loading placeholder drawable" {
+    var renderer = Renderer{};
+    const loading = Textures.PINNED_GROUP.int();
+
+    // Nothing is uploaded, so evicting only updates the bookkeeping.
+    for (visual_assets.texture_slices) |textures| {
+        for (textures) |*texture| {
+            texture.ptr = null;
+            texture.pixels = null;
+            texture.indices = null;
+            texture.palette = null;
+        }
+    }
+
+    // Every group is resident and over the budget, and the placeholder's group is the least recently drawn.
+    Textures.frame = Textures.Group.size() + 1;
+    for (&Textures.resident, &Textures.last_used_frame, 0..) |*is_resident, *last_used, group_index| {
+        is_resident.* = true;
+        last_used.* = group_index + 1;
+        Textures.resident_bytes += Textures.group_bytes[group_index];
+    }
+    Textures.last_used_frame[loading] = 0;
+
+    Textures.makeRoom(&renderer, Textures.TEXTURE_BUDGET_BYTES);
+
+    try std.testing.expect(Textures.resident[loading]);
+    try std.testing.expectEqual(Textures.group_bytes[loading], Textures.resident_bytes);
+
+    // What draw_placeholder looks up, which also marks the group as drawn.
+    try std.testing.expect(try Textures.lookupIfReady(&renderer, .UI_LOADING_ASSETS) != null);
+    try std.testing.expectEqual(Textures.frame, Textures.last_used_frame[loading]);
+}
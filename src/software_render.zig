@@ -0,0 +1,620 @@
+/// CPU compositing into a single framebuffer, for machines where SDL would otherwise fall back to a slow software path.
+/// Pixels are SDL_PIXELFORMAT_ABGR8888 stored as u32, so alpha is always the most significant byte.
+const std = @import("std");
+const utils = @import("utils.zig");
+
+const LANES = 8;
+
+// What shows where nothing is drawn. Opaque, like every pixel of the framebuffer.
+pub const CLEAR_COLOR: u32 = 0xFF000000;
+
+pub const Image = struct {
+    pixels: Pixels,
+    width: usize,
+    height: usize,
+    is_opaque: bool,
+
+    pub const Pixels = union(enum) {
+        rgba: [*]const u32,
+        // Low-colour sprites: one byte per pixel, expanded through the palette a row at a time when blitting.
+        indexed: struct { indices: [*]const u8, palette: *const [256]u32 },
+    };
+
+    // Identifies the image's contents, as long as nobody rewrites them in place.
+    pub fn address(self: Image) usize {
+        return switch (self.pixels) {
+            .rgba => |pixels| @intFromPtr(pixels),
+            .indexed => |indexed| @intFromPtr(indexed.indices),
+        };
+    }
+};
+
+// Half-open pixel rectangle: [x0, x1) x [y0, y1).
+pub const Rect = struct {
+    x0: i32,
+    y0: i32,
+    x1: i32,
+    y1: i32,
+
+    pub fn intersect(a: Rect, b: Rect) Rect {
+        return .{
+            .x0 = @max(a.x0, b.x0),
+            .y0 = @max(a.y0, b.y0),
+            .x1 = @min(a.x1, b.x1),
+            .y1 = @min(a.y1, b.y1),
+        };
+    }
+
+    pub fn isEmpty(self: Rect) bool {
+        return self.x0 >= self.x1 or self.y0 >= self.y1;
+    }
+};
+
+pub const Surface = struct {
+    pixels: []u32,
+    width: usize,
+    height: usize,
+
+    pub fn init(allocator: std.mem.Allocator, width: usize, height: usize) Surface {
+        return .{
+            .pixels = allocator.alloc(u32, width * height) catch unreachable,
+            .width = width,
+            .height = height,
+        };
+    }
+
+    pub fn deinit(self: Surface, allocator: std.mem.Allocator) void {
+        allocator.free(self.pixels);
+    }
+
+    pub fn bounds(self: Surface) Rect {
+        return .{ .x0 = 0, .y0 = 0, .x1 = @intCast(self.width), .y1 = @intCast(self.height) };
+    }
+
+    pub fn image(self: Surface, is_opaque: bool) Image {
+        return .{ .pixels = .{ .rgba = self.pixels.ptr }, .width = self.width, .height = self.height, .is_opaque = is_opaque };
+    }
+
+    pub fn fill(self: Surface, color: u32) void {
+        @memset(self.pixels, color);
+    }
+
+    pub fn fillRect(self: Surface, rect: Rect, color: u32) void {
+        const visible = rect.intersect(self.bounds());
+        if (visible.isEmpty()) return;
+
+        const col_begin: usize = @intCast(visible.x0);
+        const num_cols: usize = @intCast(visible.x1 - visible.x0);
+
+        for (@as(usize, @intCast(visible.y0))..@as(usize, @intCast(visible.y1))) |row| {
+            @memset(self.pixels[row * self.width + col_begin ..][0..num_cols], color);
+        }
+    }
+
+    pub fn blit(self: Surface, src: Image, x: i32, y: i32) void {
+        self.blitClipped(src, x, y, self.bounds());
+    }
+
+    // Draws src with its top left corner at (x, y), touching only pixels inside clip.
+    pub fn blitClipped(self: Surface, src: Image, x: i32, y: i32, clip: Rect) void {
+        const src_rect = Rect{
+            .x0 = x,
+            .y0 = y,
+            .x1 = x + @as(i32, @intCast(src.width)),
+            .y1 = y + @as(i32, @intCast(src.height)),
+        };
+        const visible = src_rect.intersect(clip).intersect(self.bounds());
+
+        if (visible.isEmpty()) return;
+
+        const row_begin: usize = @intCast(visible.y0);
+        const row_end: usize = @intCast(visible.y1);
+        const col_begin: usize = @intCast(visible.x0);
+        const num_cols: usize = @intCast(visible.x1 - visible.x0);
+        const src_col_begin: usize = @intCast(visible.x0 - x);
+
+        for (row_begin..row_end) |row| {
+            const src_row: usize = row - @as(usize, @intCast(y));
+            const src_row_begin = src_row * src.width + src_col_begin;
+            const dst_row_pixels = self.pixels[row * self.width + col_begin ..][0..num_cols];
+
+            switch (src.pixels) {
+                .rgba => |pixels| copyOrBlendRow(dst_row_pixels, pixels[src_row_begin..][0..num_cols], src.is_opaque),
+                .indexed => |indexed| {
+                    // Expanded in pieces small enough to stay in L1.
+                    var expanded: [256]u32 = undefined;
+                    var col: usize = 0;
+
+                    while (col < num_cols) : (col += expanded.len) {
+                        const length = @min(expanded.len, num_cols - col);
+
+                        expandIndexedRow(expanded[0..length], indexed.indices[src_row_begin + col ..][0..length], indexed.palette);
+                        copyOrBlendRow(dst_row_pixels[col..][0..length], expanded[0..length], src.is_opaque);
+                    }
+                },
+            }
+        }
+    }
+};
+
+// Records the blits of a frame, bins them into screen tiles and rasterises the tiles on a worker pool.
+// Each worker owns a fixed, interleaved set of tiles, so no two workers ever write the same pixel and no locking is needed.
+// A tile is only rasterised again when the hash of the commands touching it differs from the previous frame,
+// which makes mostly static screens (menus, pause) nearly free. A redrawn tile starts from CLEAR_COLOR, unless its
+// first image covers it. Image contents are identified by their pixel pointer,
+// so whoever rewrites pixels in place must call invalidate() or invalidateRect().
+pub fn TiledCompositor(comptime width: usize, comptime height: usize) type {
+    return struct {
+        const Self = @This();
+
+        pub const TILE_WIDTH = 128;
+        pub const TILE_HEIGHT = 120;
+        const NUM_TILES_X = (width + TILE_WIDTH - 1) / TILE_WIDTH;
+        const NUM_TILES_Y = (height + TILE_HEIGHT - 1) / TILE_HEIGHT;
+        const NUM_TILES = NUM_TILES_X * NUM_TILES_Y;
+        const MAX_COMMANDS = 256;
+        const MAX_WORKERS = 16;
+        pub const MAX_DIRTY_RECTS = NUM_TILES_Y * ((NUM_TILES_X + 1) / 2);
+
+        const Command = struct {
+            image: Image,
+            x: i32,
+            y: i32,
+
+            fn rect(self: Command) Rect {
+                return .{
+                    .x0 = self.x,
+                    .y0 = self.y,
+                    .x1 = self.x + @as(i32, @intCast(self.image.width)),
+                    .y1 = self.y + @as(i32, @intCast(self.image.height)),
+                };
+            }
+
+            // An opaque image covering the whole tile hides everything drawn there before it.
+            fn coversTile(self: Command, tile_rect: Rect) bool {
+                return self.image.is_opaque and std.meta.eql(self.rect().intersect(tile_rect), tile_rect);
+            }
+        };
+
+        commands: [MAX_COMMANDS]Command = undefined,
+        num_commands: usize = 0,
+        tile_commands: [NUM_TILES][MAX_COMMANDS]u16 = undefined,
+        tile_num_commands: [NUM_TILES]u16 = undefined,
+        tile_hashes: [NUM_TILES]u64 = .{0} ** NUM_TILES,
+        tile_dirty: [NUM_TILES]bool = .{true} ** NUM_TILES,
+        tile_invalidated: [NUM_TILES]bool = .{false} ** NUM_TILES,
+        num_dirty_tiles: usize = NUM_TILES,
+        force_redraw: bool = true,
+        frame_overflowed: bool = false,
+        target: Surface = undefined,
+        pool: std.Thread.Pool = undefined,
+        num_workers: usize = 1,
+
+        // The calling thread also rasterises, so the pool gets one thread less than the number of workers.
+        pub fn init(self: *Self, allocator: std.mem.Allocator) void {
+            self.num_commands = 0;
+            self.num_workers = @min(std.Thread.getCpuCount() catch 1, MAX_WORKERS);
+
+            if (self.num_workers > 1) {
+                self.pool.init(.{
+                    .allocator = allocator,
+                    .n_jobs = @intCast(self.num_workers - 1),
+                }) catch unreachable;
+            }
+        }
+
+        pub fn deinit(self: *Self) void {
+            if (self.num_workers > 1) {
+                self.pool.deinit();
+            }
+        }
+
+        pub fn push(self: *Self, target: Surface, image: Image, x: i32, y: i32) void {
+            // Rasterising early keeps the draw order intact, so running out of commands only costs an extra pass.
+            // Dirty tracking needs the whole frame at once though, so such a frame (and the next) is redrawn in full.
+            if (self.num_commands == MAX_COMMANDS) {
+                self.frame_overflowed = true;
+                self.force_redraw = true;
+                self.rasterize(target);
+            }
+            self.commands[self.num_commands] = .{ .image = image, .x = x, .y = y };
+            self.num_commands += 1;
+        }
+
+        // Called once at the end of each frame.
+        pub fn flush(self: *Self, target: Surface) void {
+            self.rasterize(target);
+            self.force_redraw = self.frame_overflowed;
+            self.frame_overflowed = false;
+        }
+
+        pub fn invalidate(self: *Self) void {
+            self.force_redraw = true;
+        }
+
+        // Redraws the tiles overlapping the rect at the next flush.
+        pub fn invalidateRect(self: *Self, rect: Rect) void {
+            const visible = rect.intersect(.{ .x0 = 0, .y0 = 0, .x1 = width, .y1 = height });
+            if (visible.isEmpty()) return;
+
+            const tile_x_begin: usize = @intCast(@divFloor(visible.x0, TILE_WIDTH));
+            const tile_x_end: usize = @intCast(@divFloor(visible.x1 - 1, TILE_WIDTH) + 1);
+            const tile_y_begin: usize = @intCast(@divFloor(visible.y0, TILE_HEIGHT));
+            const tile_y_end: usize = @intCast(@divFloor(visible.y1 - 1, TILE_HEIGHT) + 1);
+
+            for (tile_y_begin..tile_y_end) |tile_y| {
+                for (tile_x_begin..tile_x_end) |tile_x| {
+                    self.tile_invalidated[tile_y * NUM_TILES_X + tile_x] = true;
+                }
+            }
+        }
+
+        pub fn anyDirty(self: *Self) bool {
+            return self.num_dirty_tiles > 0;
+        }
+
+        // Dirty tiles of the last flush, merged into horizontal runs per row of tiles.
+        pub fn dirtyRects(self: *Self, rects: *[MAX_DIRTY_RECTS]Rect) []Rect {
+            var num_rects: usize = 0;
+
+            for (0..NUM_TILES_Y) |tile_y| {
+                var tile_x: usize = 0;
+
+                while (tile_x < NUM_TILES_X) {
+                    if (!self.tile_dirty[tile_y * NUM_TILES_X + tile_x]) {
+                        tile_x += 1;
+                        continue;
+                    }
+
+                    const run_begin = tile_x;
+                    while (tile_x < NUM_TILES_X and self.tile_dirty[tile_y * NUM_TILES_X + tile_x]) {
+                        tile_x += 1;
+                    }
+
+                    const first = tileRect(tile_y * NUM_TILES_X + run_begin);
+                    const last = tileRect(tile_y * NUM_TILES_X + tile_x - 1);
+
+                    rects[num_rects] = .{ .x0 = first.x0, .y0 = first.y0, .x1 = last.x1, .y1 = last.y1 };
+                    num_rects += 1;
+                }
+            }
+
+            return rects[0..num_rects];
+        }
+
+        fn rasterize(self: *Self, target: Surface) void {
+            utils.assert(target.width == width and target.height == height, "Compositor target must match the compositor resolution.");
+
+            self.bin(target.bounds());
+            self.markDirtyTiles();
+            self.target = target;
+
+            if (self.num_workers == 1) {
+                self.rasterizeTiles(0);
+            } else {
+                var wait_group: std.Thread.WaitGroup = .{};
+
+                for (0..self.num_workers) |worker| {
+                    self.pool.spawnWg(&wait_group, rasterizeTiles, .{ self, worker });
+                }
+                self.pool.waitAndWork(&wait_group);
+            }
+
+            self.num_commands = 0;
+        }
+
+        fn tileRect(tile: usize) Rect {
+            const tile_x: i32 = @intCast(tile % NUM_TILES_X);
+            const tile_y: i32 = @intCast(tile / NUM_TILES_X);
+
+            return .{
+                .x0 = tile_x * TILE_WIDTH,
+                .y0 = tile_y * TILE_HEIGHT,
+                .x1 = @min((tile_x + 1) * TILE_WIDTH, @as(i32, @intCast(width))),
+                .y1 = @min((tile_y + 1) * TILE_HEIGHT, @as(i32, @intCast(height))),
+            };
+        }
+
+        fn bin(self: *Self, bounds: Rect) void {
+            @memset(&self.tile_num_commands, 0);
+
+            for (self.commands[0..self.num_commands], 0..) |command, command_index| {
+                const command_rect = command.rect();
+                const visible = command_rect.intersect(bounds);
+
+                if (visible.isEmpty()) continue;
+
+                const tile_x_begin: usize = @intCast(@divFloor(visible.x0, TILE_WIDTH));
+                const tile_x_end: usize = @intCast(@divFloor(visible.x1 - 1, TILE_WIDTH) + 1);
+                const tile_y_begin: usize = @intCast(@divFloor(visible.y0, TILE_HEIGHT));
+                const tile_y_end: usize = @intCast(@divFloor(visible.y1 - 1, TILE_HEIGHT) + 1);
+
+                for (tile_y_begin..tile_y_end) |tile_y| {
+                    for (tile_x_begin..tile_x_end) |tile_x| {
+                        const tile = tile_y * NUM_TILES_X + tile_x;
+
+                        if (command.coversTile(tileRect(tile))) {
+                            self.tile_num_commands[tile] = 0;
+                        }
+
+                        self.tile_commands[tile][self.tile_num_commands[tile]] = @intCast(command_index);
+                        self.tile_num_commands[tile] += 1;
+                    }
+                }
+            }
+        }
+
+        fn markDirtyTiles(self: *Self) void {
+            self.num_dirty_tiles = 0;
+
+            for (0..NUM_TILES) |tile| {
+                var hasher = std.hash.Wyhash.init(0);
+
+                for (self.tile_commands[tile][0..self.tile_num_commands[tile]]) |command_index| {
+                    const command = self.commands[command_index];
+
+                    std.hash.autoHash(&hasher, command.image.address());
+                    std.hash.autoHash(&hasher, command.image.width);
+                    std.hash.autoHash(&hasher, command.image.height);
+                    std.hash.autoHash(&hasher, command.x);
+                    std.hash.autoHash(&hasher, command.y);
+                }
+
+                const hash = hasher.final();
+
+                self.tile_dirty[tile] = self.force_redraw or self.tile_invalidated[tile] or hash != self.tile_hashes[tile];
+                self.tile_hashes[tile] = hash;
+                self.tile_invalidated[tile] = false;
+
+                if (self.tile_dirty[tile]) self.num_dirty_tiles += 1;
+            }
+        }
+
+        fn rasterizeTiles(self: *Self, worker: usize) void {
+            var tile = worker;
+
+            while (tile < NUM_TILES) : (tile += self.num_workers) {
+                if (!self.tile_dirty[tile]) continue;
+
+                const clip = tileRect(tile);
+                const command_indices = self.tile_commands[tile][0..self.tile_num_commands[tile]];
+
+                // Otherwise what's left of the last frame would show through, or be blended over again.
+                if (command_indices.len == 0 or !self.commands[command_indices[0]].coversTile(clip)) {
+                    self.target.fillRect(clip, CLEAR_COLOR);
+                }
+
+                for (command_indices) |command_index| {
+                    const command = self.commands[command_index];
+                    self.target.blitClipped(command.image, command.x, command.y, clip);
+                }
+            }
+        }
+    };
+}
+
+fn copyOrBlendRow(dst: []u32, src: []const u32, is_opaque: bool) void {
+    if (is_opaque) {
+        @memcpy(dst, src);
+    } else {
+        blendRow(dst, src);
+    }
+}
+
+// Palette lookup, LANES pixels at a time. Written as a vector build so targets with gathers (AVX2) can use them.
+// The palette has all 256 entries, so no index can read past it.
+pub fn expandIndexedRow(dst: []u32, indices: []const u8, palette: *const [256]u32) void {
+    const Pixels = @Vector(LANES, u32);
+
+    var i: usize = 0;
+    while (i + LANES <= dst.len) : (i += LANES) {
+        const lane_indices: [LANES]u8 = indices[i..][0..LANES].*;
+        var pixels: [LANES]u32 = undefined;
+
+        inline for (&pixels, lane_indices) |*pixel, index| {
+            pixel.* = palette[index];
+        }
+
+        dst[i..][0..LANES].* = @as(Pixels, pixels);
+    }
+    while (i < dst.len) : (i += 1) {
+        dst[i] = palette[indices[i]];
+    }
+}
+
+// Source-over blending of one row. The result is always opaque, since the framebuffer is what ends up on screen.
+pub fn blendRow(dst: []u32, src: []const u32) void {
+    const Pixels = @Vector(LANES, u32);
+    const ZERO: Pixels = @splat(0);
+    const ALPHA_SHIFT: @Vector(LANES, u5) = @splat(24);
+
+    var i: usize = 0;
+    while (i + LANES <= dst.len) : (i += LANES) {
+        const src_pixels: Pixels = src[i..][0..LANES].*;
+
+        // Large parts of sprites are fully transparent, skip those without touching the destination.
+        if (!@reduce(.Or, (src_pixels >> ALPHA_SHIFT) != ZERO)) continue;
+
+        const dst_pixels: Pixels = dst[i..][0..LANES].*;
+        dst[i..][0..LANES].* = blend(LANES, src_pixels, dst_pixels);
+    }
+    while (i < dst.len) : (i += 1) {
+        dst[i] = blend(1, .{src[i]}, .{dst[i]})[0];
+    }
+}
+
+// Blends red/blue and green/alpha as two 16-bit halves of each u32 lane, so a lane never needs widening.
+// Division by 255 uses the exact (x + 128 + ((x + 128) >> 8)) >> 8 identity.
+fn blend(comptime lanes: comptime_int, src: @Vector(lanes, u32), dst: @Vector(lanes, u32)) @Vector(lanes, u32) {
+    const Pixels = @Vector(lanes, u32);
+    const Shift = @Vector(lanes, u5);
+
+    const MASK: Pixels = @splat(0x00FF00FF);
+    const ROUND: Pixels = @splat(0x00800080);
+    const OPAQUE: Pixels = @splat(0xFF000000);
+    const MAX: Pixels = @splat(0xFF);
+    const EIGHT: Shift = @splat(8);
+    const ALPHA_SHIFT: Shift = @splat(24);
+
+    const alpha = src >> ALPHA_SHIFT;
+    const inverse_alpha = MAX - alpha;
+
+    const red_blue = (src & MASK) * alpha + (dst & MASK) * inverse_alpha + ROUND;
+    const green_alpha = ((src >> EIGHT) & MASK) * alpha + ((dst >> EIGHT) & MASK) * inverse_alpha + ROUND;
+
+    const red_blue_div = ((red_blue + ((red_blue >> EIGHT) & MASK)) >> EIGHT) & MASK;
+    const green_alpha_div = (green_alpha + ((green_alpha >> EIGHT) & MASK)) & ~MASK;
+
+    return red_blue_div | green_alpha_div | OPAQUE;
+}
+
+pub fn isOpaque(pixels: []const u32) bool {
+    const Pixels = @Vector(LANES, u32);
+    const OPAQUE: Pixels = @splat(0xFF000000);
+
+    var i: usize = 0;
+    while (i + LANES <= pixels.len) : (i += LANES) {
+        const chunk: Pixels = pixels[i..][0..LANES].*;
+        if (!@reduce(.And, (chunk & OPAQUE) == OPAQUE)) return false;
+    }
+    while (i < pixels.len) : (i += 1) {
+        if (pixels[i] & 0xFF000000 != 0xFF000000) return false;
+    }
+    return true;
+}
+
+test "expandIndexedRow looks up every pixel" {
+    var palette: [256]u32 = undefined;
+    for (&palette, 0..) |*color, i| color.* = @as(u32, @intCast(i)) * 0x01010101;
+
+    var indices: [LANES * 2 + 3]u8 = undefined;
+    for (&indices, 0..) |*index, i| index.* = @intCast((i * 71) % 256);
+
+    var pixels: [indices.len]u32 = undefined;
+    expandIndexedRow(&pixels, &indices, &palette);
+
+    for (pixels, indices) |pixel, index| {
+        try std.testing.expectEqual(palette[index], pixel);
+    }
+}
+
+test "blendRow matches scalar source-over" {
+    const expectEqual = std.testing.expectEqual;
+
+    var src: [LANES + 3]u32 = undefined;
+    var dst: [LANES + 3]u32 = undefined;
+    var expected: [LANES + 3]u32 = undefined;
+
+    for (&src, &dst, &expected, 0..) |*s, *d, *e, i| {
+        const alpha: u32 = @intCast((i * 37) % 256);
+        s.* = (alpha << 24) | 0x00_40_80_C0;
+        d.* = 0xFF_10_20_30 +% @as(u32, @intCast(i));
+
+        var result: u32 = 0xFF000000;
+        inline for (.{ 0, 8, 16 }) |shift| {
+            const sc = (s.* >> shift) & 0xFF;
+            const dc = (d.* >> shift) & 0xFF;
+            const channel = (sc * alpha + dc * (255 - alpha) + 127) / 255;
+            result |= channel << shift;
+        }
+        e.* = result;
+    }
+
+    blendRow(&dst, &src);
+
+    for (dst, expected) |actual, wanted| {
+        try expectEqual(wanted, actual);
+    }
+}
+
+test "TiledCompositor matches a serial pass of blits" {
+    // Not a multiple of the tile size, so the last row and column of tiles are partial.
+    const WIDTH = 300;
+    const HEIGHT = 250;
+    const Compositor = TiledCompositor(WIDTH, HEIGHT);
+    const allocator = std.testing.allocator;
+
+    var prng = std.Random.DefaultPrng.init(0);
+    const random = prng.random();
+
+    var opaque_pixels: [WIDTH * HEIGHT]u32 = undefined;
+    var translucent_pixels: [WIDTH * HEIGHT]u32 = undefined;
+    var indices: [WIDTH * HEIGHT]u8 = undefined;
+    var palette: [256]u32 = undefined;
+
+    for (&opaque_pixels, &translucent_pixels, &indices) |*opaque_pixel, *translucent_pixel, *index| {
+        opaque_pixel.* = random.int(u32) | 0xFF000000;
+        translucent_pixel.* = random.int(u32);
+        index.* = random.int(u8);
+    }
+    for (&palette) |*color| color.* = random.int(u32);
+
+    const Sprite = struct { image: Image, x: i32, y: i32 };
+
+    const background = Image{ .pixels = .{ .rgba = &opaque_pixels }, .width = WIDTH, .height = HEIGHT, .is_opaque = true };
+    // Covers the whole of tile (1, 1), hiding what was drawn there before it.
+    const occluder = Image{ .pixels = .{ .rgba = &opaque_pixels }, .width = 140, .height = 130, .is_opaque = true };
+
+    const sprites = [_]Sprite{
+        .{ .image = background, .x = 0, .y = 0 },
+        // Translucent, across the edges between tiles.
+        .{ .image = .{ .pixels = .{ .rgba = &translucent_pixels }, .width = 70, .height = 50, .is_opaque = false }, .x = 100, .y = 100 },
+        .{ .image = .{ .pixels = .{ .rgba = &translucent_pixels }, .width = 200, .height = 30, .is_opaque = false }, .x = 50, .y = 225 },
+        .{ .image = occluder, .x = 124, .y = 115 },
+        // Indexed, and partly off screen.
+        .{ .image = .{ .pixels = .{ .indexed = .{ .indices = &indices, .palette = &palette } }, .width = 90, .height = 90, .is_opaque = false }, .x = -20, .y = 180 },
+        .{ .image = .{ .pixels = .{ .rgba = &opaque_pixels }, .width = 40, .height = 300, .is_opaque = true }, .x = 250, .y = -10 },
+        .{ .image = .{ .pixels = .{ .rgba = &translucent_pixels }, .width = 60, .height = 60, .is_opaque = false }, .x = 230, .y = 110 },
+    };
+
+    const expected = Surface.init(allocator, WIDTH, HEIGHT);
+    defer expected.deinit(allocator);
+    const actual = Surface.init(allocator, WIDTH, HEIGHT);
+    defer actual.deinit(allocator);
+
+    // Whatever the framebuffer held before gets cleared, or covered.
+    expected.fill(CLEAR_COLOR);
+    actual.fill(0x12345678);
+
+    for (sprites) |sprite| {
+        expected.blit(sprite.image, sprite.x, sprite.y);
+    }
+
+    const compositor = try allocator.create(Compositor);
+    defer allocator.destroy(compositor);
+
+    compositor.* = .{};
+    compositor.init(allocator);
+    defer compositor.deinit();
+
+    for (sprites) |sprite| {
+        compositor.push(actual, sprite.image, sprite.x, sprite.y);
+    }
+    compositor.flush(actual);
+
+    try std.testing.expectEqualSlices(u32, expected.pixels, actual.pixels);
+
+    // The tile the occluder covers only draws it and the two sprites on top of it.
+    try std.testing.expectEqual(3, compositor.tile_num_commands[1 * Compositor.NUM_TILES_X + 1]);
+
+    // Nothing changed, so the next frame redraws nothing and the pixels stay the same.
+    for (sprites) |sprite| {
+        compositor.push(actual, sprite.image, sprite.x, sprite.y);
+    }
+    compositor.flush(actual);
+
+    try std.testing.expect(!compositor.anyDirty());
+    try std.testing.expectEqualSlices(u32, expected.pixels, actual.pixels);
+
+    // Without the background, tiles left with translucent sprites or nothing at all start over from CLEAR_COLOR,
+    // instead of blending over the last frame.
+    expected.fill(CLEAR_COLOR);
+
+    for (sprites[1..]) |sprite| {
+        expected.blit(sprite.image, sprite.x, sprite.y);
+        compositor.push(actual, sprite.image, sprite.x, sprite.y);
+    }
+    compositor.flush(actual);
+
+    try std.testing.expectEqualSlices(u32, expected.pixels, actual.pixels);
+}
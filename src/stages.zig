@@ -8,6 +8,8 @@ const utils = @import("utils.zig");
 const float = @import("types.zig").float;
 const HorizontalDirection = @import("types.zig").HorizontalDirection;
 const ID = @import("visual_assets.zig").ID;
+const Group = @import("visual_assets.zig").Group;
+const GROUP_PER_ID = @import("visual_assets.zig").GROUP_PER_ID;
 
 // Functions
 const fields = @import("std").meta.fields;
@@ -170,6 +172,11 @@ pub fn stageThumbnailID(stage_id: StageID) ID {
     }
 }
 
+// Asset group holding the background and foreground layers of the stage.
+pub fn stageGroup(stage_id: StageID) Group {
+    return GROUP_PER_ID[stageAssets(stage_id).background[0].int()];
+}
+
 pub fn stageAssets(stage_id: StageID) StageAssets {
     switch (stage_id) {
         .Meteor => return StageAssets{
@@ -21,6 +21,12 @@ pub fn sdlPanic() noreturn {
     @panic(std.mem.sliceTo(str, 0));
 }
 
+// The directory the running executable is in, where the build installs the assets it generates.
+pub fn openExeDir() !std.fs.Dir {
+    var buffer: [std.fs.max_path_bytes]u8 = undefined;
+    return std.fs.openDirAbsolute(try std.fs.selfExeDirPath(&buffer), .{});
+}
+
 pub fn divAsFloat(comptime float_type: type, int_1: anytype, int_2: anytype) float_type {
     return @as(float_type, @floatFromInt(int_1)) / @as(float_type, @floatFromInt(int_2));
 }
@@ -134,6 +140,55 @@ pub fn StaticMap(comptime len: uint, comptime T_names: type, comptime T_things:
     return .{};
 }
 
+// Fixed capacity queue between exactly two threads, without locks: one only pushes, the other only pops.
+// push doesn't block, it returns false when the queue is full.
+pub fn SpscRing(comptime T: type, comptime capacity: usize) type {
+    return struct {
+        items: [capacity]T = undefined,
+        // Items ever pushed and popped. Each is only stored by its own thread.
+        pushed: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+        popped: std.atomic.Value(usize) = std.atomic.Value(usize).init(0),
+
+        pub fn push(self: *@This(), item: T) bool {
+            const pushed = self.pushed.load(.monotonic);
+            if (pushed - self.popped.load(.acquire) == capacity) return false;
+
+            self.items[pushed % capacity] = item;
+            self.pushed.store(pushed + 1, .release);
+            return true;
+        }
+
+        pub fn pop(self: *@This()) ?T {
+            const popped = self.popped.load(.monotonic);
+            if (popped == self.pushed.load(.acquire)) return null;
+
+            const item = self.items[popped % capacity];
+            self.popped.store(popped + 1, .release);
+            return item;
+        }
+
+        // Items waiting. Exact on the consumer's thread, a lower bound on the producer's.
+        pub fn len(self: *const @This()) usize {
+            return self.pushed.load(.acquire) - self.popped.load(.monotonic);
+        }
+    };
+}
+
+test "SpscRing keeps order and refuses when full" {
+    var ring = SpscRing(u32, 2){};
+
+    try std.testing.expect(ring.push(1));
+    try std.testing.expect(ring.push(2));
+    try std.testing.expect(!ring.push(3));
+
+    try std.testing.expectEqual(2, ring.len());
+    try std.testing.expectEqual(1, ring.pop());
+    try std.testing.expect(ring.push(3));
+    try std.testing.expectEqual(2, ring.pop());
+    try std.testing.expectEqual(3, ring.pop());
+    try std.testing.expectEqual(null, ring.pop());
+}
+
 test "StaticMap functionality" {
     var my_map = StaticMap(8, []const u8, []const u8);
     try my_map.insert("One", "Thing 1", false);
@@ -2,7 +2,14 @@
 # While it's just a bunch of string manipulation to write some zig code,
 # it's also not pretty, but should be understandable by looking at the code and the output it makes (assets.zig).
 
-from os import path, scandir
+import hashlib
+import struct
+import zlib
+from itertools import accumulate
+import sys
+from io import StringIO
+from multiprocessing import Pool
+from os import path, scandir, walk
 
 FILE_HEADER = (
     """\
@@ -18,13 +25,33 @@ const print = @import("std").debug.print;
 
 pub const Texture = struct {
     ptr: ?*SDL_Texture,
-    width: c_int,
+    width: c_int, // Size of the trimmed texture.
     height: c_int,
+    x_offset: c_int, // Position of the trimmed texture inside the frame.
+    y_offset: c_int,
+    full_width: c_int, // Size of the frame as drawn by the artist.
+    full_height: c_int,
+    pixels: ?[*]u32, // CPU-side copy, only kept when compositing in software.
+    indices: ?[*]u8 = null, // Instead of pixels, for frames stored indexed in the asset pack.
+    palette: ?*[256]u32 = null,
+    is_opaque: bool,
+};
+
+// Bounding box of the non-transparent pixels of a frame.
+pub const Trim = struct {
+    x: u16,
+    y: u16,
+    width: u16,
+    height: u16,
+    full_width: u16,
+    full_height: u16,
 };
 
 pub const Asset = struct {
     path: []const u8,
     id: ID,
+    trim: Trim,
+    duplicate_of: ?u16 = null, // Index in ALL of an identical frame of the same group, whose texture this one shares.
 };
 """
 )
@@ -46,6 +73,24 @@ ENUM_FOOTER = """\
 """
 
 
+GROUP_HEADER = """\
+// Textures are loaded and evicted one group at a time. A group is a character, a stage, or a menu/UI element.
+// Stage thumbnails get a group of their own, since they are shown while stages themselves aren't needed.
+pub const Group = enum(u16) {
+"""
+
+GROUP_FOOTER = """\
+
+    pub inline fn int(group: Group) u16 {
+        return @intFromEnum(group);
+    }
+
+    pub inline fn size() u16 {
+        return fields(Group).len;
+    }
+};
+"""
+
 ASSETS_PRE_HEADER = "pub const ALL: ["
 
 ASSETS_POST_HEADER = "]Asset = .{\n"
@@ -89,20 +134,189 @@ ID_FROM_MODE_FOOTER = """\
 }
 """
 
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+# Animations with frames at least this large (about a quarter of the screen) are delta encoded in the asset pack.
+DELTA_MIN_FULL_PIXELS = 500_000
+
+
+# Each channel of an 8-bit RGBA PNG is predicted only from the same channel of its neighbours,
+# so the alpha channel can be unfiltered on its own, at a quarter of the cost of a full decode.
+def unfilter_alpha_row(filter_type, row, previous_row):
+    if filter_type == 0:
+        return row
+
+    if filter_type == 1:
+        return bytes(accumulate(row, lambda left, value: (left + value) & 0xFF))
+
+    if filter_type == 2:
+        return bytes((value + up) & 0xFF for value, up in zip(row, previous_row))
+
+    unfiltered = bytearray(len(row))
+    left = 0
+    up_left = 0
+
+    if filter_type == 3:
+        for i, (value, up) in enumerate(zip(row, previous_row)):
+            left = (value + ((left + up) >> 1)) & 0xFF
+            unfiltered[i] = left
+    else:
+        for i, (value, up) in enumerate(zip(row, previous_row)):
+            estimate = left + up - up_left
+            distance_left = abs(estimate - left)
+            distance_up = abs(estimate - up)
+            distance_up_left = abs(estimate - up_left)
+
+            if distance_left <= distance_up and distance_left <= distance_up_left:
+                predictor = left
+            elif distance_up <= distance_up_left:
+                predictor = up
+            else:
+                predictor = up_left
+
+            left = (value + predictor) & 0xFF
+            unfiltered[i] = left
+            up_left = up
+
+    return bytes(unfiltered)
+
+
+# Returns the bounding box of the non-transparent pixels of a PNG (see opaque_bounding_box),
+# and a hash of its content, equal for frames holding the same pixels.
+def scan_png(png_path):
+    with open(png_path, "rb") as png_file:
+        data = png_file.read()
+
+    assert data.startswith(PNG_SIGNATURE), png_path + " is not a PNG file."
+
+    position = len(PNG_SIGNATURE)
+    compressed = []
+
+    while position < len(data):
+        length, chunk_type = struct.unpack(">I4s", data[position : position + 8])
+        chunk = data[position + 8 : position + 8 + length]
+        position += 12 + length
+
+        if chunk_type == b"IHDR":
+            width, height, bit_depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif chunk_type == b"IDAT":
+            compressed.append(chunk)
+        elif chunk_type == b"IEND":
+            break
+
+    scanlines = zlib.decompress(b"".join(compressed))
+
+    # Filtered scanlines decide the pixels, so equal hashes mean equal frames. The same pixels filtered
+    # differently are missed, which only costs a duplicate texture.
+    content_hash = hashlib.sha256(struct.pack(">IIBBB", width, height, bit_depth, color_type, interlace) + scanlines).hexdigest()
+
+    if bit_depth != 8 or color_type != 6 or interlace != 0:
+        return (0, 0, width, height, width, height), content_hash
+
+    return opaque_bounding_box(scanlines, width, height), content_hash
+
+
+# Returns (x, y, width, height, full_width, full_height) of the non-transparent pixels of an 8-bit RGBA image.
+def opaque_bounding_box(scanlines, width, height):
+    stride = 4 * width
+    transparent_row = bytes(width)
+    previous_alpha = transparent_row
+    x_min, y_min, x_max, y_max = width, height, 0, 0
+
+    for y in range(height):
+        start = y * (stride + 1)
+        filtered_alpha = scanlines[start + 1 : start + 1 + stride][3::4]
+
+        # Any filter applied to zeros above zeros gives zeros, which skips most of the padding.
+        if previous_alpha == transparent_row and filtered_alpha == transparent_row:
+            alpha = transparent_row
+        else:
+            alpha = unfilter_alpha_row(scanlines[start], filtered_alpha, previous_alpha)
+
+        if alpha != transparent_row:
+            x_min = min(x_min, width - len(alpha.lstrip(b"\0")))
+            x_max = max(x_max, len(alpha.rstrip(b"\0")))
+            y_min = min(y_min, y)
+            y_max = y + 1
+
+        previous_alpha = alpha
+
+    # Keep a single pixel of fully transparent frames, since textures can't be empty.
+    if x_max <= x_min:
+        return (0, 0, 1, 1, width, height)
+
+    return (x_min, y_min, x_max - x_min, y_max - y_min, width, height)
+
+
+# Smallest box holding every one of the bounding boxes, all in frames of the same size.
+def union_bounding_box(bounding_boxes):
+    x_min = min(x for x, _, _, _, _, _ in bounding_boxes)
+    y_min = min(y for _, y, _, _, _, _ in bounding_boxes)
+    x_max = max(x + width for x, _, width, _, _, _ in bounding_boxes)
+    y_max = max(y + height for _, y, _, height, _, _ in bounding_boxes)
+    _, _, _, _, full_width, full_height = bounding_boxes[0]
+
+    return (x_min, y_min, x_max - x_min, y_max - y_min, full_width, full_height)
+
+
+def is_delta_encoded(bounding_boxes):
+    full_sizes = {(full_width, full_height) for _, _, _, _, full_width, full_height in bounding_boxes}
+    full_width, full_height = next(iter(full_sizes))
+
+    return len(bounding_boxes) > 1 and len(full_sizes) == 1 and full_width * full_height >= DELTA_MIN_FULL_PIXELS
+
+
+def trim_string(bounding_box):
+    x, y, width, height, full_width, full_height = bounding_box
+    return (
+        ".{ .x = " + str(x)
+        + ", .y = " + str(y)
+        + ", .width = " + str(width)
+        + ", .height = " + str(height)
+        + ", .full_width = " + str(full_width)
+        + ", .full_height = " + str(full_height)
+        + " }"
+    )
+
+
+# Directory order differs between file systems, so entries are sorted to make the output depend on the assets alone.
+def sorted_scandir(directory):
+    return sorted(scandir(directory), key=lambda entry: entry.name)
+
+
 # Run this file from the project root (i.e. the battlebuds/ directory).
-# Update: script is automatically called from build.zig now.
+# Update: script is automatically called from build.zig now, with the output path as argument,
+# and only re-run when an asset changes.
 if __name__ == "__main__":
     print("\nRUNNING:", __file__, "\n")
     TAB_SIZE = 4
     asset_dir = "assets/visual"
-    output_file = "src/visual_assets.zig"
-
-    with open(output_file, "w") as outfile:
+    output_file = sys.argv[1] if len(sys.argv) > 1 else "src/visual_assets.zig"
+
+    # Trimming needs the alpha channel of every frame, so do it in parallel before generating any code.
+    png_paths = [
+        path.relpath(path.join(directory, file_name), ".")
+        for directory, _, file_names in walk(asset_dir)
+        for file_name in file_names
+        if file_name.endswith(".png")
+    ]
+    with Pool() as pool:
+        scans = dict(zip(png_paths, pool.map(scan_png, png_paths)))
+
+    # Identical frames of one group share a texture. Not across groups, since those are loaded and evicted separately.
+    first_asset_per_content = {}
+    num_duplicates = 0
+    duplicate_bytes = 0
+
+    with StringIO() as outfile:
         print(FILE_HEADER, file=outfile)
 
         enum_string = ENUM_HEADER
         assets_string = ""
         assets_per_id = []
+        group_per_id = []
+        delta_canvas_per_id = []
+        groups = []
         texture_array_names = []
         mode_strings = []
         entity_mode_string = ENTITY_MODE_HEADER
@@ -111,13 +325,13 @@ if __name__ == "__main__":
         id_from_mode_string = ID_FROM_MODE_HEADER
 
         total_num_assets = 0
-        for asset_type_dir in scandir(asset_dir):
+        for asset_type_dir in sorted_scandir(asset_dir):
             if not asset_type_dir.is_dir():
                 continue
 
             asset_type = asset_type_dir.name
 
-            for asset_subtype_dir in scandir(asset_type_dir.path):
+            for asset_subtype_dir in sorted_scandir(asset_type_dir.path):
                 if not asset_subtype_dir.is_dir():
                     continue
 
@@ -136,7 +350,7 @@ if __name__ == "__main__":
                 )
 
                 has_animations = False
-                for animation_dir in scandir(asset_subtype_dir.path):
+                for animation_dir in sorted_scandir(asset_subtype_dir.path):
                     if not animation_dir.is_dir():
                         continue
 
@@ -151,20 +365,42 @@ if __name__ == "__main__":
                     )
                     num_assets = 0
 
+                    if animation.upper() == "THUMBNAIL":
+                        group = asset_type.upper() + "_THUMBNAILS"
+                    else:
+                        group = asset_type.upper() + "_" + asset_subtype.upper()
+
                     # We sort images by name for animation to play in order.
                     def sort_query(img) -> int:
                         return int(img.name.strip(".png"))
 
-                    for image in sorted(scandir(animation_dir.path), key=sort_query):
-                        if not image.is_file():
-                            continue
+                    images = [image for image in sorted(scandir(animation_dir.path), key=sort_query) if image.is_file()]
+                    animation_boxes = [scans[path.relpath(image.path, ".")][0] for image in images]
+                    delta_encoded = len(images) > 0 and is_delta_encoded(animation_boxes)
 
+                    for image in images:
+                        image_path = path.relpath(image.path, ".")
+                        bounding_box, content_hash = scans[image_path]
+                        asset_index = total_num_assets + num_assets
                         num_assets += 1
+
+                        duplicate_of = first_asset_per_content.setdefault((group, content_hash), asset_index)
+                        duplicate_string = ""
+
+                        # In a delta encoded animation, a frame equal to the one before it is already nearly free.
+                        if duplicate_of != asset_index and not delta_encoded:
+                            duplicate_string = ", .duplicate_of = " + str(duplicate_of)
+                            num_duplicates += 1
+                            duplicate_bytes += 4 * bounding_box[2] * bounding_box[3]
+
                         assets_string += (
                             '\t.{ .path = "'
-                            + path.relpath(image.path, ".")
+                            + image_path
                             + '", .id = .'
                             + id
+                            + ", .trim = "
+                            + trim_string(bounding_box)
+                            + duplicate_string
                             + " },\n"
                         )
 
@@ -174,6 +410,10 @@ if __name__ == "__main__":
                         mode_string += "\t" + mode + ",\n"
                         id_from_mode += "\t\t\t." + mode + " => return ID." + id + ",\n"
                         assets_per_id.append(num_assets)
+                        if group not in groups:
+                            groups.append(group)
+                        group_per_id.append(group)
+                        delta_canvas_per_id.append(union_bounding_box(animation_boxes) if delta_encoded else None)
                         texture_array_names.append(id.lower() + "_textures")
                         total_num_assets += num_assets
 
@@ -226,6 +466,29 @@ if __name__ == "__main__":
         )
         print(assets_per_id_string.expandtabs(TAB_SIZE), file=outfile)
 
+        group_string = GROUP_HEADER
+        for group in groups:
+            group_string += "\t" + group + ",\n"
+        group_string += GROUP_FOOTER
+        print(group_string.expandtabs(TAB_SIZE), file=outfile)
+
+        group_per_id_string = (
+            "pub const GROUP_PER_ID: [ID.size()]Group = .{ "
+            + ", ".join("." + group for group in group_per_id)
+            + " };\n"
+        )
+        print(group_per_id_string.expandtabs(TAB_SIZE), file=outfile)
+
+        delta_canvas_string = (
+            "// Delta encoded animations are drawn on one canvas covering every frame, and only the region that changes\n"
+            + "// from one frame to the next is stored and uploaded. Null for animations stored frame by frame.\n"
+            + "pub const DELTA_CANVAS_PER_ID: [ID.size()]?Trim = .{\n"
+        )
+        for canvas in delta_canvas_per_id:
+            delta_canvas_string += "\t" + ("null" if canvas is None else trim_string(canvas)) + ",\n"
+        delta_canvas_string += "};\n"
+        print(delta_canvas_string.expandtabs(TAB_SIZE), file=outfile)
+
         print("// Storage for textures to be initialized at runtime.", file=outfile)
         for size, array_name in zip(assets_per_id, texture_array_names):
             print(
@@ -237,3 +500,14 @@ if __name__ == "__main__":
         for array_name in texture_array_names:
             print(("\t&" + array_name + ",").expandtabs(TAB_SIZE), file=outfile)
         print("};", file=outfile)
+
+        with open(output_file, "w") as output:
+            output.write(outfile.getvalue())
+
+    print(
+        "Deduplicated "
+        + str(num_duplicates)
+        + " identical frames, saving "
+        + str(round(duplicate_bytes / 2**20, 1))
+        + " MB of textures.\n"
+    )
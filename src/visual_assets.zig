@@ -8,81 +8,101 @@ const print = @import("std").debug.print;
 
 pub const Texture = struct {
     ptr: ?*SDL_Texture,
-    width: c_int,
+    width: c_int, // Size of the trimmed texture.
     height: c_int,
+    x_offset: c_int, // Position of the trimmed texture inside the frame.
+    y_offset: c_int,
+    full_width: c_int, // Size of the frame as drawn by the artist.
+    full_height: c_int,
+    pixels: ?[*]u32, // CPU-side copy, only kept when compositing in software.
+    indices: ?[*]u8 = null, // Instead of pixels, for frames stored indexed in the asset pack.
+    palette: ?*[256]u32 = null,
+    is_opaque: bool,
+};
+
+// Bounding box of the non-transparent pixels of a frame.
+pub const Trim = struct {
+    x: u16,
+    y: u16,
+    width: u16,
+    height: u16,
+    full_width: u16,
+    full_height: u16,
 };
 
 pub const Asset = struct {
     path: []const u8,
     id: ID,
+    trim: Trim,
+    duplicate_of: ?u16 = null, // Index in ALL of an identical frame of the same group, whose texture this one shares.
 };
 
 pub const ID = enum(u16) {
-    CHARACTER_TEST_FLYING_RIGHT,
-    CHARACTER_TEST_STANDING,
+    CHARACTER_TEST_ATTACKING_DOWN,
     CHARACTER_TEST_ATTACKING_LEFT,
-    CHARACTER_TEST_FLYING_LEFT,
-    CHARACTER_TEST_RUNNING_RIGHT,
     CHARACTER_TEST_ATTACKING_RIGHT,
-    CHARACTER_TEST_RUNNING_LEFT,
-    CHARACTER_TEST_ATTACKING_DOWN,
     CHARACTER_TEST_ATTACKING_UP,
+    CHARACTER_TEST_FLYING_LEFT,
     CHARACTER_TEST_FLYING_NEUTRAL,
+    CHARACTER_TEST_FLYING_RIGHT,
     CHARACTER_TEST_JUMPING,
-    CHARACTER_WURMPLE_FLYING_RIGHT,
-    CHARACTER_WURMPLE_STANDING,
+    CHARACTER_TEST_RUNNING_LEFT,
+    CHARACTER_TEST_RUNNING_RIGHT,
+    CHARACTER_TEST_STANDING,
+    CHARACTER_WURMPLE_ATTACKING_DOWN,
     CHARACTER_WURMPLE_ATTACKING_LEFT,
-    CHARACTER_WURMPLE_FLYING_LEFT,
-    CHARACTER_WURMPLE_RUNNING_RIGHT,
     CHARACTER_WURMPLE_ATTACKING_RIGHT,
-    CHARACTER_WURMPLE_RUNNING_LEFT,
-    CHARACTER_WURMPLE_ATTACKING_DOWN,
     CHARACTER_WURMPLE_ATTACKING_UP,
+    CHARACTER_WURMPLE_FLYING_LEFT,
     CHARACTER_WURMPLE_FLYING_NEUTRAL,
+    CHARACTER_WURMPLE_FLYING_RIGHT,
     CHARACTER_WURMPLE_JUMPING,
+    CHARACTER_WURMPLE_RUNNING_LEFT,
+    CHARACTER_WURMPLE_RUNNING_RIGHT,
+    CHARACTER_WURMPLE_STANDING,
     DONT_LOAD_TEXTURE,
+    MENU_STAGE_SELECTED,
+    MENU_WAITING_FORINPUT,
     PROJECTILE_TEST_FLYING_DOWN,
-    PROJECTILE_TEST_FLYING_RIGHT,
     PROJECTILE_TEST_FLYING_LEFT,
+    PROJECTILE_TEST_FLYING_RIGHT,
     PROJECTILE_TEST_FLYING_UP,
-    UI_AMMO_EQUALS4,
+    STAGE_METEOR_BACKGROUND,
+    STAGE_METEOR_FLOOR,
+    STAGE_METEOR_PLATFORMS,
+    STAGE_METEOR_THUMBNAIL,
+    STAGE_TEST00_BACKGROUND,
+    STAGE_TEST00_PLATFORMS,
+    STAGE_TEST00_THUMBNAIL,
+    UI_AMMO_EQUALS0,
     UI_AMMO_EQUALS1,
-    UI_AMMO_EQUALS7,
     UI_AMMO_EQUALS2,
-    UI_AMMO_EQUALS6,
-    UI_AMMO_EQUALS0,
     UI_AMMO_EQUALS3,
+    UI_AMMO_EQUALS4,
     UI_AMMO_EQUALS5,
-    UI_PLAYER_NOTPLAYING,
-    UI_PLAYER_PLAYING,
-    UI_HEALTH_EQUALS4,
-    UI_HEALTH_EQUALS11,
+    UI_AMMO_EQUALS6,
+    UI_AMMO_EQUALS7,
+    UI_HEALTH_EQUALS0,
     UI_HEALTH_EQUALS1,
-    UI_HEALTH_EQUALS15,
-    UI_HEALTH_EQUALS8,
-    UI_HEALTH_EQUALS14,
-    UI_HEALTH_EQUALS12,
-    UI_HEALTH_EQUALS7,
-    UI_HEALTH_EQUALS2,
-    UI_HEALTH_EQUALS6,
-    UI_HEALTH_EQUALS9,
     UI_HEALTH_EQUALS10,
-    UI_HEALTH_EQUALS0,
+    UI_HEALTH_EQUALS11,
+    UI_HEALTH_EQUALS12,
     UI_HEALTH_EQUALS13,
+    UI_HEALTH_EQUALS14,
+    UI_HEALTH_EQUALS15,
+    UI_HEALTH_EQUALS2,
     UI_HEALTH_EQUALS3,
+    UI_HEALTH_EQUALS4,
     UI_HEALTH_EQUALS5,
-    UI_QUITTING_GAME,
+    UI_HEALTH_EQUALS6,
+    UI_HEALTH_EQUALS7,
+    UI_HEALTH_EQUALS8,
+    UI_HEALTH_EQUALS9,
     UI_LOADING_ASSETS,
     UI_PAUSED_BACKGROUND,
-    STAGE_METEOR_BACKGROUND,
-    STAGE_METEOR_THUMBNAIL,
-    STAGE_METEOR_PLATFORMS,
-    STAGE_METEOR_FLOOR,
-    STAGE_TEST00_BACKGROUND,
-    STAGE_TEST00_THUMBNAIL,
-    STAGE_TEST00_PLATFORMS,
-    MENU_WAITING_FORINPUT,
-    MENU_STAGE_SELECTED,
+    UI_PLAYER_NOTPLAYING,
+    UI_PLAYER_PLAYING,
+    UI_QUITTING_GAME,
 
     pub inline fn int(id: ID) u16 {
         return @intFromEnum(id);
@@ -96,74 +116,84 @@ pub const ID = enum(u16) {
 pub fn IDFromEntityMode(mode: EntityMode) ID {
     switch (mode) {
         .character_test => |character_test_mode| switch (character_test_mode) {
-            .FLYING_RIGHT => return ID.CHARACTER_TEST_FLYING_RIGHT,
-            .STANDING => return ID.CHARACTER_TEST_STANDING,
+            .ATTACKING_DOWN => return ID.CHARACTER_TEST_ATTACKING_DOWN,
             .ATTACKING_LEFT => return ID.CHARACTER_TEST_ATTACKING_LEFT,
-            .FLYING_LEFT => return ID.CHARACTER_TEST_FLYING_LEFT,
-            .RUNNING_RIGHT => return ID.CHARACTER_TEST_RUNNING_RIGHT,
             .ATTACKING_RIGHT => return ID.CHARACTER_TEST_ATTACKING_RIGHT,
-            .RUNNING_LEFT => return ID.CHARACTER_TEST_RUNNING_LEFT,
-            .ATTACKING_DOWN => return ID.CHARACTER_TEST_ATTACKING_DOWN,
             .ATTACKING_UP => return ID.CHARACTER_TEST_ATTACKING_UP,
+            .FLYING_LEFT => return ID.CHARACTER_TEST_FLYING_LEFT,
             .FLYING_NEUTRAL => return ID.CHARACTER_TEST_FLYING_NEUTRAL,
+            .FLYING_RIGHT => return ID.CHARACTER_TEST_FLYING_RIGHT,
             .JUMPING => return ID.CHARACTER_TEST_JUMPING,
+            .RUNNING_LEFT => return ID.CHARACTER_TEST_RUNNING_LEFT,
+            .RUNNING_RIGHT => return ID.CHARACTER_TEST_RUNNING_RIGHT,
+            .STANDING => return ID.CHARACTER_TEST_STANDING,
         },
         .character_wurmple => |character_wurmple_mode| switch (character_wurmple_mode) {
-            .FLYING_RIGHT => return ID.CHARACTER_WURMPLE_FLYING_RIGHT,
-            .STANDING => return ID.CHARACTER_WURMPLE_STANDING,
+            .ATTACKING_DOWN => return ID.CHARACTER_WURMPLE_ATTACKING_DOWN,
             .ATTACKING_LEFT => return ID.CHARACTER_WURMPLE_ATTACKING_LEFT,
-            .FLYING_LEFT => return ID.CHARACTER_WURMPLE_FLYING_LEFT,
-            .RUNNING_RIGHT => return ID.CHARACTER_WURMPLE_RUNNING_RIGHT,
             .ATTACKING_RIGHT => return ID.CHARACTER_WURMPLE_ATTACKING_RIGHT,
-            .RUNNING_LEFT => return ID.CHARACTER_WURMPLE_RUNNING_LEFT,
-            .ATTACKING_DOWN => return ID.CHARACTER_WURMPLE_ATTACKING_DOWN,
             .ATTACKING_UP => return ID.CHARACTER_WURMPLE_ATTACKING_UP,
+            .FLYING_LEFT => return ID.CHARACTER_WURMPLE_FLYING_LEFT,
             .FLYING_NEUTRAL => return ID.CHARACTER_WURMPLE_FLYING_NEUTRAL,
+            .FLYING_RIGHT => return ID.CHARACTER_WURMPLE_FLYING_RIGHT,
             .JUMPING => return ID.CHARACTER_WURMPLE_JUMPING,
+            .RUNNING_LEFT => return ID.CHARACTER_WURMPLE_RUNNING_LEFT,
+            .RUNNING_RIGHT => return ID.CHARACTER_WURMPLE_RUNNING_RIGHT,
+            .STANDING => return ID.CHARACTER_WURMPLE_STANDING,
         },
         .dont_load => |dont_load_mode| switch (dont_load_mode) {
             .TEXTURE => return ID.DONT_LOAD_TEXTURE,
         },
+        .menu_stage => |menu_stage_mode| switch (menu_stage_mode) {
+            .SELECTED => return ID.MENU_STAGE_SELECTED,
+        },
+        .menu_waiting => |menu_waiting_mode| switch (menu_waiting_mode) {
+            .FORINPUT => return ID.MENU_WAITING_FORINPUT,
+        },
         .projectile_test => |projectile_test_mode| switch (projectile_test_mode) {
             .FLYING_DOWN => return ID.PROJECTILE_TEST_FLYING_DOWN,
-            .FLYING_RIGHT => return ID.PROJECTILE_TEST_FLYING_RIGHT,
             .FLYING_LEFT => return ID.PROJECTILE_TEST_FLYING_LEFT,
+            .FLYING_RIGHT => return ID.PROJECTILE_TEST_FLYING_RIGHT,
             .FLYING_UP => return ID.PROJECTILE_TEST_FLYING_UP,
         },
+        .stage_meteor => |stage_meteor_mode| switch (stage_meteor_mode) {
+            .BACKGROUND => return ID.STAGE_METEOR_BACKGROUND,
+            .FLOOR => return ID.STAGE_METEOR_FLOOR,
+            .PLATFORMS => return ID.STAGE_METEOR_PLATFORMS,
+            .THUMBNAIL => return ID.STAGE_METEOR_THUMBNAIL,
+        },
+        .stage_test00 => |stage_test00_mode| switch (stage_test00_mode) {
+            .BACKGROUND => return ID.STAGE_TEST00_BACKGROUND,
+            .PLATFORMS => return ID.STAGE_TEST00_PLATFORMS,
+            .THUMBNAIL => return ID.STAGE_TEST00_THUMBNAIL,
+        },
         .ui_ammo => |ui_ammo_mode| switch (ui_ammo_mode) {
-            .EQUALS4 => return ID.UI_AMMO_EQUALS4,
+            .EQUALS0 => return ID.UI_AMMO_EQUALS0,
             .EQUALS1 => return ID.UI_AMMO_EQUALS1,
-            .EQUALS7 => return ID.UI_AMMO_EQUALS7,
             .EQUALS2 => return ID.UI_AMMO_EQUALS2,
-            .EQUALS6 => return ID.UI_AMMO_EQUALS6,
-            .EQUALS0 => return ID.UI_AMMO_EQUALS0,
             .EQUALS3 => return ID.UI_AMMO_EQUALS3,
+            .EQUALS4 => return ID.UI_AMMO_EQUALS4,
             .EQUALS5 => return ID.UI_AMMO_EQUALS5,
-        },
-        .ui_player => |ui_player_mode| switch (ui_player_mode) {
-            .NOTPLAYING => return ID.UI_PLAYER_NOTPLAYING,
-            .PLAYING => return ID.UI_PLAYER_PLAYING,
+            .EQUALS6 => return ID.UI_AMMO_EQUALS6,
+            .EQUALS7 => return ID.UI_AMMO_EQUALS7,
         },
         .ui_health => |ui_health_mode| switch (ui_health_mode) {
-            .EQUALS4 => return ID.UI_HEALTH_EQUALS4,
-            .EQUALS11 => return ID.UI_HEALTH_EQUALS11,
+            .EQUALS0 => return ID.UI_HEALTH_EQUALS0,
             .EQUALS1 => return ID.UI_HEALTH_EQUALS1,
-            .EQUALS15 => return ID.UI_HEALTH_EQUALS15,
-            .EQUALS8 => return ID.UI_HEALTH_EQUALS8,
-            .EQUALS14 => return ID.UI_HEALTH_EQUALS14,
-            .EQUALS12 => return ID.UI_HEALTH_EQUALS12,
-            .EQUALS7 => return ID.UI_HEALTH_EQUALS7,
-            .EQUALS2 => return ID.UI_HEALTH_EQUALS2,
-            .EQUALS6 => return ID.UI_HEALTH_EQUALS6,
-            .EQUALS9 => return ID.UI_HEALTH_EQUALS9,
             .EQUALS10 => return ID.UI_HEALTH_EQUALS10,
-            .EQUALS0 => return ID.UI_HEALTH_EQUALS0,
+            .EQUALS11 => return ID.UI_HEALTH_EQUALS11,
+            .EQUALS12 => return ID.UI_HEALTH_EQUALS12,
             .EQUALS13 => return ID.UI_HEALTH_EQUALS13,
+            .EQUALS14 => return ID.UI_HEALTH_EQUALS14,
+            .EQUALS15 => return ID.UI_HEALTH_EQUALS15,
+            .EQUALS2 => return ID.UI_HEALTH_EQUALS2,
             .EQUALS3 => return ID.UI_HEALTH_EQUALS3,
+            .EQUALS4 => return ID.UI_HEALTH_EQUALS4,
             .EQUALS5 => return ID.UI_HEALTH_EQUALS5,
-        },
-        .ui_quitting => |ui_quitting_mode| switch (ui_quitting_mode) {
-            .GAME => return ID.UI_QUITTING_GAME,
+            .EQUALS6 => return ID.UI_HEALTH_EQUALS6,
+            .EQUALS7 => return ID.UI_HEALTH_EQUALS7,
+            .EQUALS8 => return ID.UI_HEALTH_EQUALS8,
+            .EQUALS9 => return ID.UI_HEALTH_EQUALS9,
         },
         .ui_loading => |ui_loading_mode| switch (ui_loading_mode) {
             .ASSETS => return ID.UI_LOADING_ASSETS,
@@ -171,22 +201,12 @@ pub fn IDFromEntityMode(mode: EntityMode) ID {
         .ui_paused => |ui_paused_mode| switch (ui_paused_mode) {
             .BACKGROUND => return ID.UI_PAUSED_BACKGROUND,
         },
-        .stage_meteor => |stage_meteor_mode| switch (stage_meteor_mode) {
-            .BACKGROUND => return ID.STAGE_METEOR_BACKGROUND,
-            .THUMBNAIL => return ID.STAGE_METEOR_THUMBNAIL,
-            .PLATFORMS => return ID.STAGE_METEOR_PLATFORMS,
-            .FLOOR => return ID.STAGE_METEOR_FLOOR,
-        },
-        .stage_test00 => |stage_test00_mode| switch (stage_test00_mode) {
-            .BACKGROUND => return ID.STAGE_TEST00_BACKGROUND,
-            .THUMBNAIL => return ID.STAGE_TEST00_THUMBNAIL,
-            .PLATFORMS => return ID.STAGE_TEST00_PLATFORMS,
-        },
-        .menu_waiting => |menu_waiting_mode| switch (menu_waiting_mode) {
-            .FORINPUT => return ID.MENU_WAITING_FORINPUT,
+        .ui_player => |ui_player_mode| switch (ui_player_mode) {
+            .NOTPLAYING => return ID.UI_PLAYER_NOTPLAYING,
+            .PLAYING => return ID.UI_PLAYER_PLAYING,
         },
-        .menu_stage => |menu_stage_mode| switch (menu_stage_mode) {
-            .SELECTED => return ID.MENU_STAGE_SELECTED,
+        .ui_quitting => |ui_quitting_mode| switch (ui_quitting_mode) {
+            .GAME => return ID.UI_QUITTING_GAME,
         },
     }
     unreachable; // shouldn't happen
@@ -196,34 +216,34 @@ pub const EntityMode = union(enum(u16)) {
     character_test: CharacterTestMode,
     character_wurmple: CharacterWurmpleMode,
     dont_load: DontLoadMode,
+    menu_stage: MenuStageMode,
+    menu_waiting: MenuWaitingMode,
     projectile_test: ProjectileTestMode,
+    stage_meteor: StageMeteorMode,
+    stage_test00: StageTest00Mode,
     ui_ammo: UiAmmoMode,
-    ui_player: UiPlayerMode,
     ui_health: UiHealthMode,
-    ui_quitting: UiQuittingMode,
     ui_loading: UiLoadingMode,
     ui_paused: UiPausedMode,
-    stage_meteor: StageMeteorMode,
-    stage_test00: StageTest00Mode,
-    menu_waiting: MenuWaitingMode,
-    menu_stage: MenuStageMode,
+    ui_player: UiPlayerMode,
+    ui_quitting: UiQuittingMode,
 
     pub fn from_enum_literal(comptime Type: type, comptime val: @TypeOf(.enum_literal)) @This() {
         switch (Type) {
             CharacterTestMode => |Enum| return @unionInit(@This(), "character_test", @as(Enum, val)),
             CharacterWurmpleMode => |Enum| return @unionInit(@This(), "character_wurmple", @as(Enum, val)),
             DontLoadMode => |Enum| return @unionInit(@This(), "dont_load", @as(Enum, val)),
+            MenuStageMode => |Enum| return @unionInit(@This(), "menu_stage", @as(Enum, val)),
+            MenuWaitingMode => |Enum| return @unionInit(@This(), "menu_waiting", @as(Enum, val)),
             ProjectileTestMode => |Enum| return @unionInit(@This(), "projectile_test", @as(Enum, val)),
+            StageMeteorMode => |Enum| return @unionInit(@This(), "stage_meteor", @as(Enum, val)),
+            StageTest00Mode => |Enum| return @unionInit(@This(), "stage_test00", @as(Enum, val)),
             UiAmmoMode => |Enum| return @unionInit(@This(), "ui_ammo", @as(Enum, val)),
-            UiPlayerMode => |Enum| return @unionInit(@This(), "ui_player", @as(Enum, val)),
             UiHealthMode => |Enum| return @unionInit(@This(), "ui_health", @as(Enum, val)),
-            UiQuittingMode => |Enum| return @unionInit(@This(), "ui_quitting", @as(Enum, val)),
             UiLoadingMode => |Enum| return @unionInit(@This(), "ui_loading", @as(Enum, val)),
             UiPausedMode => |Enum| return @unionInit(@This(), "ui_paused", @as(Enum, val)),
-            StageMeteorMode => |Enum| return @unionInit(@This(), "stage_meteor", @as(Enum, val)),
-            StageTest00Mode => |Enum| return @unionInit(@This(), "stage_test00", @as(Enum, val)),
-            MenuWaitingMode => |Enum| return @unionInit(@This(), "menu_waiting", @as(Enum, val)),
-            MenuStageMode => |Enum| return @unionInit(@This(), "menu_stage", @as(Enum, val)),
+            UiPlayerMode => |Enum| return @unionInit(@This(), "ui_player", @as(Enum, val)),
+            UiQuittingMode => |Enum| return @unionInit(@This(), "ui_quitting", @as(Enum, val)),
 
             else => |mode| {
                 print("\nUnexpected entity mode: {any}\n", .{mode});
@@ -234,81 +254,93 @@ pub const EntityMode = union(enum(u16)) {
 };
 
 pub const CharacterTestMode = enum(u16) {
-    FLYING_RIGHT,
-    STANDING,
+    ATTACKING_DOWN,
     ATTACKING_LEFT,
-    FLYING_LEFT,
-    RUNNING_RIGHT,
     ATTACKING_RIGHT,
-    RUNNING_LEFT,
-    ATTACKING_DOWN,
     ATTACKING_UP,
+    FLYING_LEFT,
     FLYING_NEUTRAL,
+    FLYING_RIGHT,
     JUMPING,
+    RUNNING_LEFT,
+    RUNNING_RIGHT,
+    STANDING,
 };
 
 pub const CharacterWurmpleMode = enum(u16) {
-    FLYING_RIGHT,
-    STANDING,
+    ATTACKING_DOWN,
     ATTACKING_LEFT,
-    FLYING_LEFT,
-    RUNNING_RIGHT,
     ATTACKING_RIGHT,
-    RUNNING_LEFT,
-    ATTACKING_DOWN,
     ATTACKING_UP,
+    FLYING_LEFT,
     FLYING_NEUTRAL,
+    FLYING_RIGHT,
     JUMPING,
+    RUNNING_LEFT,
+    RUNNING_RIGHT,
+    STANDING,
 };
 
 pub const DontLoadMode = enum(u16) {
     TEXTURE,
 };
 
+pub const MenuStageMode = enum(u16) {
+    SELECTED,
+};
+
+pub const MenuWaitingMode = enum(u16) {
+    FORINPUT,
+};
+
 pub const ProjectileTestMode = enum(u16) {
     FLYING_DOWN,
-    FLYING_RIGHT,
     FLYING_LEFT,
+    FLYING_RIGHT,
     FLYING_UP,
 };
 
+pub const StageMeteorMode = enum(u16) {
+    BACKGROUND,
+    FLOOR,
+    PLATFORMS,
+    THUMBNAIL,
+};
+
+pub const StageTest00Mode = enum(u16) {
+    BACKGROUND,
+    PLATFORMS,
+    THUMBNAIL,
+};
+
 pub const UiAmmoMode = enum(u16) {
-    EQUALS4,
+    EQUALS0,
     EQUALS1,
-    EQUALS7,
     EQUALS2,
-    EQUALS6,
-    EQUALS0,
     EQUALS3,
+    EQUALS4,
     EQUALS5,
-};
-
-pub const UiPlayerMode = enum(u16) {
-    NOTPLAYING,
-    PLAYING,
+    EQUALS6,
+    EQUALS7,
 };
 
 pub const UiHealthMode = enum(u16) {
-    EQUALS4,
-    EQUALS11,
+    EQUALS0,
     EQUALS1,
-    EQUALS15,
-    EQUALS8,
-    EQUALS14,
-    EQUALS12,
-    EQUALS7,
-    EQUALS2,
-    EQUALS6,
-    EQUALS9,
     EQUALS10,
-    EQUALS0,
+    EQUALS11,
+    EQUALS12,
     EQUALS13,
+    EQUALS14,
+    EQUALS15,
+    EQUALS2,
     EQUALS3,
+    EQUALS4,
     EQUALS5,
-};
-
-pub const UiQuittingMode = enum(u16) {
-    GAME,
+    EQUALS6,
+    EQUALS7,
+    EQUALS8,
+    EQUALS9,
 };
 
 pub const UiLoadingMode = enum(u16) {
@@ -319,521 +351,609 @@ pub const UiPausedMode = enum(u16) {
     BACKGROUND,
 };
 
-pub const StageMeteorMode = enum(u16) {
-    BACKGROUND,
-    THUMBNAIL,
-    PLATFORMS,
-    FLOOR,
+pub const UiPlayerMode = enum(u16) {
+    NOTPLAYING,
+    PLAYING,
 };
 
-pub const StageTest00Mode = enum(u16) {
-    BACKGROUND,
-    THUMBNAIL,
-    PLATFORMS,
+pub const UiQuittingMode = enum(u16) {
+    GAME,
 };
 
-pub const MenuWaitingMode = enum(u16) {
-    FORINPUT,
+pub const ALL: [358]Asset = .{
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/1.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 7, .y = 11, .width = 76, .height = 89, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/2.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 7, .y = 10, .width = 76, .height = 90, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/3.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 13, .y = 15, .width = 69, .height = 85, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/4.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 9, .y = 21, .width = 68, .height = 79, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/5.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 7, .y = 17, .width = 74, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/6.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 6, .y = 18, .width = 75, .height = 82, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/7.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 5, .y = 17, .width = 75, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/8.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 5, .y = 18, .width = 74, .height = 82, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/9.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 6, .y = 17, .width = 73, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/10.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 2, .y = 17, .width = 79, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/11.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 2, .y = 14, .width = 75, .height = 86, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Down/12.png", .id = .CHARACTER_TEST_ATTACKING_DOWN, .trim = .{ .x = 0, .y = 12, .width = 81, .height = 88, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/1.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 17, .y = 11, .width = 76, .height = 89, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/2.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 17, .y = 10, .width = 76, .height = 90, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/3.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 18, .y = 15, .width = 69, .height = 85, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/4.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 23, .y = 21, .width = 68, .height = 79, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/5.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 19, .y = 17, .width = 74, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/6.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 19, .y = 18, .width = 75, .height = 82, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/7.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 20, .y = 17, .width = 75, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/8.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 21, .y = 18, .width = 74, .height = 82, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/9.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 21, .y = 17, .width = 73, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/10.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 19, .y = 17, .width = 79, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/11.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 23, .y = 14, .width = 75, .height = 86, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Left/12.png", .id = .CHARACTER_TEST_ATTACKING_LEFT, .trim = .{ .x = 19, .y = 12, .width = 81, .height = 88, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/1.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 7, .y = 11, .width = 76, .height = 89, .full_width = 100, .full_height = 100 }, .duplicate_of = 0 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/2.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 7, .y = 10, .width = 76, .height = 90, .full_width = 100, .full_height = 100 }, .duplicate_of = 1 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/3.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 13, .y = 15, .width = 69, .height = 85, .full_width = 100, .full_height = 100 }, .duplicate_of = 2 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/4.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 9, .y = 21, .width = 68, .height = 79, .full_width = 100, .full_height = 100 }, .duplicate_of = 3 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/5.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 7, .y = 17, .width = 74, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 4 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/6.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 6, .y = 18, .width = 75, .height = 82, .full_width = 100, .full_height = 100 }, .duplicate_of = 5 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/7.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 5, .y = 17, .width = 75, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 6 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/8.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 5, .y = 18, .width = 74, .height = 82, .full_width = 100, .full_height = 100 }, .duplicate_of = 7 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/9.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 6, .y = 17, .width = 73, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 8 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/10.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 2, .y = 17, .width = 79, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 9 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/11.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 2, .y = 14, .width = 75, .height = 86, .full_width = 100, .full_height = 100 }, .duplicate_of = 10 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Right/12.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT, .trim = .{ .x = 0, .y = 12, .width = 81, .height = 88, .full_width = 100, .full_height = 100 }, .duplicate_of = 11 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/1.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 7, .y = 11, .width = 76, .height = 89, .full_width = 100, .full_height = 100 }, .duplicate_of = 0 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/2.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 7, .y = 10, .width = 76, .height = 90, .full_width = 100, .full_height = 100 }, .duplicate_of = 1 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/3.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 13, .y = 15, .width = 69, .height = 85, .full_width = 100, .full_height = 100 }, .duplicate_of = 2 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/4.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 9, .y = 21, .width = 68, .height = 79, .full_width = 100, .full_height = 100 }, .duplicate_of = 3 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/5.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 7, .y = 17, .width = 74, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 4 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/6.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 6, .y = 18, .width = 75, .height = 82, .full_width = 100, .full_height = 100 }, .duplicate_of = 5 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/7.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 5, .y = 17, .width = 75, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 6 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/8.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 5, .y = 18, .width = 74, .height = 82, .full_width = 100, .full_height = 100 }, .duplicate_of = 7 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/9.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 6, .y = 17, .width = 73, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 8 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/10.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 2, .y = 17, .width = 79, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 9 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/11.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 2, .y = 14, .width = 75, .height = 86, .full_width = 100, .full_height = 100 }, .duplicate_of = 10 },
+    .{ .path = "assets/visual/Character/Test/Attacking_Up/12.png", .id = .CHARACTER_TEST_ATTACKING_UP, .trim = .{ .x = 0, .y = 12, .width = 81, .height = 88, .full_width = 100, .full_height = 100 }, .duplicate_of = 11 },
+    .{ .path = "assets/visual/Character/Test/Flying_Left/1.png", .id = .CHARACTER_TEST_FLYING_LEFT, .trim = .{ .x = 17, .y = 26, .width = 63, .height = 39, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Left/2.png", .id = .CHARACTER_TEST_FLYING_LEFT, .trim = .{ .x = 51, .y = 22, .width = 32, .height = 47, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Left/3.png", .id = .CHARACTER_TEST_FLYING_LEFT, .trim = .{ .x = 64, .y = 15, .width = 15, .height = 59, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Left/4.png", .id = .CHARACTER_TEST_FLYING_LEFT, .trim = .{ .x = 29, .y = 30, .width = 51, .height = 28, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Left/5.png", .id = .CHARACTER_TEST_FLYING_LEFT, .trim = .{ .x = 6, .y = 36, .width = 76, .height = 16, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Neutral/1.png", .id = .CHARACTER_TEST_FLYING_NEUTRAL, .trim = .{ .x = 26, .y = 30, .width = 41, .height = 41, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Neutral/2.png", .id = .CHARACTER_TEST_FLYING_NEUTRAL, .trim = .{ .x = 25, .y = 31, .width = 42, .height = 41, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Neutral/3.png", .id = .CHARACTER_TEST_FLYING_NEUTRAL, .trim = .{ .x = 24, .y = 30, .width = 41, .height = 42, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Neutral/4.png", .id = .CHARACTER_TEST_FLYING_NEUTRAL, .trim = .{ .x = 23, .y = 33, .width = 44, .height = 42, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Neutral/5.png", .id = .CHARACTER_TEST_FLYING_NEUTRAL, .trim = .{ .x = 23, .y = 31, .width = 45, .height = 44, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Right/1.png", .id = .CHARACTER_TEST_FLYING_RIGHT, .trim = .{ .x = 20, .y = 26, .width = 63, .height = 39, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Right/2.png", .id = .CHARACTER_TEST_FLYING_RIGHT, .trim = .{ .x = 17, .y = 22, .width = 32, .height = 47, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Right/3.png", .id = .CHARACTER_TEST_FLYING_RIGHT, .trim = .{ .x = 21, .y = 15, .width = 15, .height = 59, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Right/4.png", .id = .CHARACTER_TEST_FLYING_RIGHT, .trim = .{ .x = 20, .y = 30, .width = 51, .height = 28, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Flying_Right/5.png", .id = .CHARACTER_TEST_FLYING_RIGHT, .trim = .{ .x = 18, .y = 36, .width = 76, .height = 16, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Jumping/1.png", .id = .CHARACTER_TEST_JUMPING, .trim = .{ .x = 30, .y = 43, .width = 37, .height = 57, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Jumping/2.png", .id = .CHARACTER_TEST_JUMPING, .trim = .{ .x = 26, .y = 57, .width = 45, .height = 43, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Jumping/3.png", .id = .CHARACTER_TEST_JUMPING, .trim = .{ .x = 11, .y = 79, .width = 69, .height = 21, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Jumping/4.png", .id = .CHARACTER_TEST_JUMPING, .trim = .{ .x = 25, .y = 55, .width = 46, .height = 44, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Jumping/5.png", .id = .CHARACTER_TEST_JUMPING, .trim = .{ .x = 35, .y = 40, .width = 27, .height = 60, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Running_Left/1.png", .id = .CHARACTER_TEST_RUNNING_LEFT, .trim = .{ .x = 16, .y = 32, .width = 66, .height = 68, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Running_Left/2.png", .id = .CHARACTER_TEST_RUNNING_LEFT, .trim = .{ .x = 18, .y = 31, .width = 66, .height = 69, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Running_Left/3.png", .id = .CHARACTER_TEST_RUNNING_LEFT, .trim = .{ .x = 20, .y = 30, .width = 66, .height = 70, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Running_Left/4.png", .id = .CHARACTER_TEST_RUNNING_LEFT, .trim = .{ .x = 22, .y = 28, .width = 66, .height = 72, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Running_Left/5.png", .id = .CHARACTER_TEST_RUNNING_LEFT, .trim = .{ .x = 15, .y = 32, .width = 75, .height = 68, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Running_Right/1.png", .id = .CHARACTER_TEST_RUNNING_RIGHT, .trim = .{ .x = 18, .y = 32, .width = 66, .height = 68, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Running_Right/2.png", .id = .CHARACTER_TEST_RUNNING_RIGHT, .trim = .{ .x = 16, .y = 31, .width = 66, .height = 69, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Running_Right/3.png", .id = .CHARACTER_TEST_RUNNING_RIGHT, .trim = .{ .x = 14, .y = 30, .width = 66, .height = 70, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Running_Right/4.png", .id = .CHARACTER_TEST_RUNNING_RIGHT, .trim = .{ .x = 12, .y = 28, .width = 66, .height = 72, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Running_Right/5.png", .id = .CHARACTER_TEST_RUNNING_RIGHT, .trim = .{ .x = 10, .y = 32, .width = 75, .height = 68, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Standing/1.png", .id = .CHARACTER_TEST_STANDING, .trim = .{ .x = 31, .y = 30, .width = 36, .height = 70, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Standing/2.png", .id = .CHARACTER_TEST_STANDING, .trim = .{ .x = 32, .y = 30, .width = 30, .height = 70, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Standing/3.png", .id = .CHARACTER_TEST_STANDING, .trim = .{ .x = 36, .y = 31, .width = 31, .height = 69, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Standing/4.png", .id = .CHARACTER_TEST_STANDING, .trim = .{ .x = 32, .y = 32, .width = 41, .height = 68, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Standing/5.png", .id = .CHARACTER_TEST_STANDING, .trim = .{ .x = 34, .y = 31, .width = 33, .height = 69, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Test/Standing/6.png", .id = .CHARACTER_TEST_STANDING, .trim = .{ .x = 32, .y = 30, .width = 32, .height = 70, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/1.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 7, .y = 11, .width = 76, .height = 89, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/2.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 7, .y = 10, .width = 76, .height = 90, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/3.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 13, .y = 15, .width = 69, .height = 85, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/4.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 9, .y = 21, .width = 68, .height = 79, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/5.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 7, .y = 17, .width = 74, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/6.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 6, .y = 18, .width = 75, .height = 82, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/7.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 5, .y = 17, .width = 75, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/8.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 5, .y = 18, .width = 74, .height = 82, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/9.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 6, .y = 17, .width = 73, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/10.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 2, .y = 17, .width = 79, .height = 83, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/11.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 2, .y = 14, .width = 75, .height = 86, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/12.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN, .trim = .{ .x = 0, .y = 12, .width = 81, .height = 88, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/1.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 7, .y = 11, .width = 76, .height = 89, .full_width = 100, .full_height = 100 }, .duplicate_of = 84 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/2.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 7, .y = 10, .width = 76, .height = 90, .full_width = 100, .full_height = 100 }, .duplicate_of = 85 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/3.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 13, .y = 15, .width = 69, .height = 85, .full_width = 100, .full_height = 100 }, .duplicate_of = 86 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/4.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 9, .y = 21, .width = 68, .height = 79, .full_width = 100, .full_height = 100 }, .duplicate_of = 87 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/5.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 7, .y = 17, .width = 74, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 88 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/6.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 6, .y = 18, .width = 75, .height = 82, .full_width = 100, .full_height = 100 }, .duplicate_of = 89 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/7.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 5, .y = 17, .width = 75, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 90 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/8.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 5, .y = 18, .width = 74, .height = 82, .full_width = 100, .full_height = 100 }, .duplicate_of = 91 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/9.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 6, .y = 17, .width = 73, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 92 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/10.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 2, .y = 17, .width = 79, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 93 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/11.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 2, .y = 14, .width = 75, .height = 86, .full_width = 100, .full_height = 100 }, .duplicate_of = 94 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/12.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT, .trim = .{ .x = 0, .y = 12, .width = 81, .height = 88, .full_width = 100, .full_height = 100 }, .duplicate_of = 95 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/1.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 7, .y = 11, .width = 76, .height = 89, .full_width = 100, .full_height = 100 }, .duplicate_of = 84 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/2.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 7, .y = 10, .width = 76, .height = 90, .full_width = 100, .full_height = 100 }, .duplicate_of = 85 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/3.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 13, .y = 15, .width = 69, .height = 85, .full_width = 100, .full_height = 100 }, .duplicate_of = 86 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/4.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 9, .y = 21, .width = 68, .height = 79, .full_width = 100, .full_height = 100 }, .duplicate_of = 87 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/5.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 7, .y = 17, .width = 74, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 88 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/6.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 6, .y = 18, .width = 75, .height = 82, .full_width = 100, .full_height = 100 }, .duplicate_of = 89 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/7.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 5, .y = 17, .width = 75, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 90 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/8.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 5, .y = 18, .width = 74, .height = 82, .full_width = 100, .full_height = 100 }, .duplicate_of = 91 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/9.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 6, .y = 17, .width = 73, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 92 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/10.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 2, .y = 17, .width = 79, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 93 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/11.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 2, .y = 14, .width = 75, .height = 86, .full_width = 100, .full_height = 100 }, .duplicate_of = 94 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/12.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT, .trim = .{ .x = 0, .y = 12, .width = 81, .height = 88, .full_width = 100, .full_height = 100 }, .duplicate_of = 95 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/1.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 7, .y = 11, .width = 76, .height = 89, .full_width = 100, .full_height = 100 }, .duplicate_of = 84 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/2.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 7, .y = 10, .width = 76, .height = 90, .full_width = 100, .full_height = 100 }, .duplicate_of = 85 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/3.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 13, .y = 15, .width = 69, .height = 85, .full_width = 100, .full_height = 100 }, .duplicate_of = 86 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/4.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 9, .y = 21, .width = 68, .height = 79, .full_width = 100, .full_height = 100 }, .duplicate_of = 87 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/5.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 7, .y = 17, .width = 74, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 88 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/6.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 6, .y = 18, .width = 75, .height = 82, .full_width = 100, .full_height = 100 }, .duplicate_of = 89 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/7.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 5, .y = 17, .width = 75, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 90 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/8.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 5, .y = 18, .width = 74, .height = 82, .full_width = 100, .full_height = 100 }, .duplicate_of = 91 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/9.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 6, .y = 17, .width = 73, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 92 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/10.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 2, .y = 17, .width = 79, .height = 83, .full_width = 100, .full_height = 100 }, .duplicate_of = 93 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/11.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 2, .y = 14, .width = 75, .height = 86, .full_width = 100, .full_height = 100 }, .duplicate_of = 94 },
+    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/12.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP, .trim = .{ .x = 0, .y = 12, .width = 81, .height = 88, .full_width = 100, .full_height = 100 }, .duplicate_of = 95 },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Left/1.png", .id = .CHARACTER_WURMPLE_FLYING_LEFT, .trim = .{ .x = 17, .y = 26, .width = 63, .height = 39, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Left/2.png", .id = .CHARACTER_WURMPLE_FLYING_LEFT, .trim = .{ .x = 51, .y = 22, .width = 32, .height = 47, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Left/3.png", .id = .CHARACTER_WURMPLE_FLYING_LEFT, .trim = .{ .x = 64, .y = 15, .width = 15, .height = 59, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Left/4.png", .id = .CHARACTER_WURMPLE_FLYING_LEFT, .trim = .{ .x = 29, .y = 30, .width = 51, .height = 28, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Left/5.png", .id = .CHARACTER_WURMPLE_FLYING_LEFT, .trim = .{ .x = 6, .y = 36, .width = 76, .height = 16, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Neutral/1.png", .id = .CHARACTER_WURMPLE_FLYING_NEUTRAL, .trim = .{ .x = 26, .y = 30, .width = 41, .height = 41, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Neutral/2.png", .id = .CHARACTER_WURMPLE_FLYING_NEUTRAL, .trim = .{ .x = 25, .y = 31, .width = 42, .height = 41, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Neutral/3.png", .id = .CHARACTER_WURMPLE_FLYING_NEUTRAL, .trim = .{ .x = 24, .y = 30, .width = 41, .height = 42, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Neutral/4.png", .id = .CHARACTER_WURMPLE_FLYING_NEUTRAL, .trim = .{ .x = 23, .y = 33, .width = 44, .height = 42, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Neutral/5.png", .id = .CHARACTER_WURMPLE_FLYING_NEUTRAL, .trim = .{ .x = 23, .y = 31, .width = 45, .height = 44, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Right/1.png", .id = .CHARACTER_WURMPLE_FLYING_RIGHT, .trim = .{ .x = 20, .y = 26, .width = 63, .height = 39, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Right/2.png", .id = .CHARACTER_WURMPLE_FLYING_RIGHT, .trim = .{ .x = 17, .y = 22, .width = 32, .height = 47, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Right/3.png", .id = .CHARACTER_WURMPLE_FLYING_RIGHT, .trim = .{ .x = 21, .y = 15, .width = 15, .height = 59, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Right/4.png", .id = .CHARACTER_WURMPLE_FLYING_RIGHT, .trim = .{ .x = 20, .y = 30, .width = 51, .height = 28, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Flying_Right/5.png", .id = .CHARACTER_WURMPLE_FLYING_RIGHT, .trim = .{ .x = 18, .y = 36, .width = 76, .height = 16, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Jumping/1.png", .id = .CHARACTER_WURMPLE_JUMPING, .trim = .{ .x = 30, .y = 43, .width = 37, .height = 57, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Jumping/2.png", .id = .CHARACTER_WURMPLE_JUMPING, .trim = .{ .x = 26, .y = 57, .width = 45, .height = 43, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Jumping/3.png", .id = .CHARACTER_WURMPLE_JUMPING, .trim = .{ .x = 11, .y = 79, .width = 69, .height = 21, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Jumping/4.png", .id = .CHARACTER_WURMPLE_JUMPING, .trim = .{ .x = 25, .y = 55, .width = 46, .height = 44, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Jumping/5.png", .id = .CHARACTER_WURMPLE_JUMPING, .trim = .{ .x = 35, .y = 40, .width = 27, .height = 60, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Running_Left/1.png", .id = .CHARACTER_WURMPLE_RUNNING_LEFT, .trim = .{ .x = 2, .y = 0, .width = 98, .height = 100, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Running_Left/2.png", .id = .CHARACTER_WURMPLE_RUNNING_LEFT, .trim = .{ .x = 0, .y = 0, .width = 98, .height = 100, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Running_Left/3.png", .id = .CHARACTER_WURMPLE_RUNNING_LEFT, .trim = .{ .x = 0, .y = 1, .width = 100, .height = 99, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Running_Left/4.png", .id = .CHARACTER_WURMPLE_RUNNING_LEFT, .trim = .{ .x = 0, .y = 0, .width = 100, .height = 100, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Running_Left/5.png", .id = .CHARACTER_WURMPLE_RUNNING_LEFT, .trim = .{ .x = 0, .y = 0, .width = 100, .height = 100, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Running_Right/1.png", .id = .CHARACTER_WURMPLE_RUNNING_RIGHT, .trim = .{ .x = 0, .y = 0, .width = 98, .height = 100, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Running_Right/2.png", .id = .CHARACTER_WURMPLE_RUNNING_RIGHT, .trim = .{ .x = 2, .y = 0, .width = 98, .height = 100, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Running_Right/3.png", .id = .CHARACTER_WURMPLE_RUNNING_RIGHT, .trim = .{ .x = 0, .y = 1, .width = 100, .height = 99, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Running_Right/4.png", .id = .CHARACTER_WURMPLE_RUNNING_RIGHT, .trim = .{ .x = 0, .y = 0, .width = 100, .height = 100, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Running_Right/5.png", .id = .CHARACTER_WURMPLE_RUNNING_RIGHT, .trim = .{ .x = 0, .y = 0, .width = 100, .height = 100, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Standing/1.png", .id = .CHARACTER_WURMPLE_STANDING, .trim = .{ .x = 31, .y = 30, .width = 36, .height = 70, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Standing/2.png", .id = .CHARACTER_WURMPLE_STANDING, .trim = .{ .x = 32, .y = 30, .width = 30, .height = 70, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Standing/3.png", .id = .CHARACTER_WURMPLE_STANDING, .trim = .{ .x = 36, .y = 31, .width = 31, .height = 69, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Standing/4.png", .id = .CHARACTER_WURMPLE_STANDING, .trim = .{ .x = 32, .y = 32, .width = 41, .height = 68, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Standing/5.png", .id = .CHARACTER_WURMPLE_STANDING, .trim = .{ .x = 34, .y = 31, .width = 33, .height = 69, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Character/Wurmple/Standing/6.png", .id = .CHARACTER_WURMPLE_STANDING, .trim = .{ .x = 32, .y = 30, .width = 32, .height = 70, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Dont/Load/Texture/1.png", .id = .DONT_LOAD_TEXTURE, .trim = .{ .x = 0, .y = 0, .width = 100, .height = 100, .full_width = 100, .full_height = 100 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/1.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/2.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/3.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/4.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/5.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/6.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/7.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/8.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/9.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/10.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/11.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Stage/Selected/12.png", .id = .MENU_STAGE_SELECTED, .trim = .{ .x = 0, .y = 0, .width = 1, .height = 1, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Menu/Waiting/ForInput/1.png", .id = .MENU_WAITING_FORINPUT, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Down/1.png", .id = .PROJECTILE_TEST_FLYING_DOWN, .trim = .{ .x = 4, .y = 1, .width = 46, .height = 27, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Down/2.png", .id = .PROJECTILE_TEST_FLYING_DOWN, .trim = .{ .x = 5, .y = 1, .width = 45, .height = 27, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Down/3.png", .id = .PROJECTILE_TEST_FLYING_DOWN, .trim = .{ .x = 5, .y = 1, .width = 45, .height = 26, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Down/4.png", .id = .PROJECTILE_TEST_FLYING_DOWN, .trim = .{ .x = 5, .y = 1, .width = 45, .height = 26, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Down/5.png", .id = .PROJECTILE_TEST_FLYING_DOWN, .trim = .{ .x = 5, .y = 1, .width = 44, .height = 26, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Down/6.png", .id = .PROJECTILE_TEST_FLYING_DOWN, .trim = .{ .x = 5, .y = 0, .width = 45, .height = 28, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Down/7.png", .id = .PROJECTILE_TEST_FLYING_DOWN, .trim = .{ .x = 2, .y = 0, .width = 48, .height = 29, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Down/8.png", .id = .PROJECTILE_TEST_FLYING_DOWN, .trim = .{ .x = 3, .y = 0, .width = 47, .height = 29, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Down/9.png", .id = .PROJECTILE_TEST_FLYING_DOWN, .trim = .{ .x = 4, .y = 1, .width = 46, .height = 28, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Down/10.png", .id = .PROJECTILE_TEST_FLYING_DOWN, .trim = .{ .x = 4, .y = 0, .width = 46, .height = 29, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Left/1.png", .id = .PROJECTILE_TEST_FLYING_LEFT, .trim = .{ .x = 4, .y = 1, .width = 46, .height = 27, .full_width = 50, .full_height = 30 }, .duplicate_of = 182 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Left/2.png", .id = .PROJECTILE_TEST_FLYING_LEFT, .trim = .{ .x = 5, .y = 1, .width = 45, .height = 27, .full_width = 50, .full_height = 30 }, .duplicate_of = 183 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Left/3.png", .id = .PROJECTILE_TEST_FLYING_LEFT, .trim = .{ .x = 5, .y = 1, .width = 45, .height = 26, .full_width = 50, .full_height = 30 }, .duplicate_of = 184 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Left/4.png", .id = .PROJECTILE_TEST_FLYING_LEFT, .trim = .{ .x = 5, .y = 1, .width = 45, .height = 26, .full_width = 50, .full_height = 30 }, .duplicate_of = 185 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Left/5.png", .id = .PROJECTILE_TEST_FLYING_LEFT, .trim = .{ .x = 5, .y = 1, .width = 44, .height = 26, .full_width = 50, .full_height = 30 }, .duplicate_of = 186 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Left/6.png", .id = .PROJECTILE_TEST_FLYING_LEFT, .trim = .{ .x = 5, .y = 0, .width = 45, .height = 28, .full_width = 50, .full_height = 30 }, .duplicate_of = 187 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Left/7.png", .id = .PROJECTILE_TEST_FLYING_LEFT, .trim = .{ .x = 2, .y = 0, .width = 48, .height = 29, .full_width = 50, .full_height = 30 }, .duplicate_of = 188 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Left/8.png", .id = .PROJECTILE_TEST_FLYING_LEFT, .trim = .{ .x = 3, .y = 0, .width = 47, .height = 29, .full_width = 50, .full_height = 30 }, .duplicate_of = 189 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Left/9.png", .id = .PROJECTILE_TEST_FLYING_LEFT, .trim = .{ .x = 4, .y = 1, .width = 46, .height = 28, .full_width = 50, .full_height = 30 }, .duplicate_of = 190 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Left/10.png", .id = .PROJECTILE_TEST_FLYING_LEFT, .trim = .{ .x = 4, .y = 0, .width = 46, .height = 29, .full_width = 50, .full_height = 30 }, .duplicate_of = 191 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Right/1.png", .id = .PROJECTILE_TEST_FLYING_RIGHT, .trim = .{ .x = 0, .y = 1, .width = 46, .height = 27, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Right/2.png", .id = .PROJECTILE_TEST_FLYING_RIGHT, .trim = .{ .x = 0, .y = 1, .width = 45, .height = 27, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Right/3.png", .id = .PROJECTILE_TEST_FLYING_RIGHT, .trim = .{ .x = 0, .y = 1, .width = 45, .height = 26, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Right/4.png", .id = .PROJECTILE_TEST_FLYING_RIGHT, .trim = .{ .x = 0, .y = 1, .width = 45, .height = 26, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Right/5.png", .id = .PROJECTILE_TEST_FLYING_RIGHT, .trim = .{ .x = 1, .y = 1, .width = 44, .height = 26, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Right/6.png", .id = .PROJECTILE_TEST_FLYING_RIGHT, .trim = .{ .x = 0, .y = 0, .width = 45, .height = 28, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Right/7.png", .id = .PROJECTILE_TEST_FLYING_RIGHT, .trim = .{ .x = 0, .y = 0, .width = 48, .height = 29, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Right/8.png", .id = .PROJECTILE_TEST_FLYING_RIGHT, .trim = .{ .x = 0, .y = 0, .width = 47, .height = 29, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Right/9.png", .id = .PROJECTILE_TEST_FLYING_RIGHT, .trim = .{ .x = 0, .y = 1, .width = 46, .height = 28, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Right/10.png", .id = .PROJECTILE_TEST_FLYING_RIGHT, .trim = .{ .x = 0, .y = 0, .width = 46, .height = 29, .full_width = 50, .full_height = 30 } },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Up/1.png", .id = .PROJECTILE_TEST_FLYING_UP, .trim = .{ .x = 4, .y = 1, .width = 46, .height = 27, .full_width = 50, .full_height = 30 }, .duplicate_of = 182 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Up/2.png", .id = .PROJECTILE_TEST_FLYING_UP, .trim = .{ .x = 5, .y = 1, .width = 45, .height = 27, .full_width = 50, .full_height = 30 }, .duplicate_of = 183 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Up/3.png", .id = .PROJECTILE_TEST_FLYING_UP, .trim = .{ .x = 5, .y = 1, .width = 45, .height = 26, .full_width = 50, .full_height = 30 }, .duplicate_of = 184 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Up/4.png", .id = .PROJECTILE_TEST_FLYING_UP, .trim = .{ .x = 5, .y = 1, .width = 45, .height = 26, .full_width = 50, .full_height = 30 }, .duplicate_of = 185 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Up/5.png", .id = .PROJECTILE_TEST_FLYING_UP, .trim = .{ .x = 5, .y = 1, .width = 44, .height = 26, .full_width = 50, .full_height = 30 }, .duplicate_of = 186 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Up/6.png", .id = .PROJECTILE_TEST_FLYING_UP, .trim = .{ .x = 5, .y = 0, .width = 45, .height = 28, .full_width = 50, .full_height = 30 }, .duplicate_of = 187 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Up/7.png", .id = .PROJECTILE_TEST_FLYING_UP, .trim = .{ .x = 2, .y = 0, .width = 48, .height = 29, .full_width = 50, .full_height = 30 }, .duplicate_of = 188 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Up/8.png", .id = .PROJECTILE_TEST_FLYING_UP, .trim = .{ .x = 3, .y = 0, .width = 47, .height = 29, .full_width = 50, .full_height = 30 }, .duplicate_of = 189 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Up/9.png", .id = .PROJECTILE_TEST_FLYING_UP, .trim = .{ .x = 4, .y = 1, .width = 46, .height = 28, .full_width = 50, .full_height = 30 }, .duplicate_of = 190 },
+    .{ .path = "assets/visual/Projectile/Test/Flying_Up/10.png", .id = .PROJECTILE_TEST_FLYING_UP, .trim = .{ .x = 4, .y = 0, .width = 46, .height = 29, .full_width = 50, .full_height = 30 }, .duplicate_of = 191 },
+    .{ .path = "assets/visual/Stage/Meteor/Background/1.png", .id = .STAGE_METEOR_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Stage/Meteor/Floor/1.png", .id = .STAGE_METEOR_FLOOR, .trim = .{ .x = 2, .y = 375, .width = 1918, .height = 705, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Stage/Meteor/Platforms/1.png", .id = .STAGE_METEOR_PLATFORMS, .trim = .{ .x = 114, .y = 199, .width = 1692, .height = 522, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/1.png", .id = .STAGE_METEOR_THUMBNAIL, .trim = .{ .x = 0, .y = 0, .width = 940, .height = 540, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/2.png", .id = .STAGE_METEOR_THUMBNAIL, .trim = .{ .x = 0, .y = 4, .width = 934, .height = 536, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/3.png", .id = .STAGE_METEOR_THUMBNAIL, .trim = .{ .x = 0, .y = 10, .width = 926, .height = 530, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/4.png", .id = .STAGE_METEOR_THUMBNAIL, .trim = .{ .x = 0, .y = 18, .width = 926, .height = 522, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/5.png", .id = .STAGE_METEOR_THUMBNAIL, .trim = .{ .x = 0, .y = 18, .width = 932, .height = 522, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/6.png", .id = .STAGE_METEOR_THUMBNAIL, .trim = .{ .x = 0, .y = 10, .width = 934, .height = 530, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/7.png", .id = .STAGE_METEOR_THUMBNAIL, .trim = .{ .x = 0, .y = 4, .width = 934, .height = 536, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/8.png", .id = .STAGE_METEOR_THUMBNAIL, .trim = .{ .x = 0, .y = 2, .width = 930, .height = 538, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/9.png", .id = .STAGE_METEOR_THUMBNAIL, .trim = .{ .x = 0, .y = 0, .width = 934, .height = 540, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/10.png", .id = .STAGE_METEOR_THUMBNAIL, .trim = .{ .x = 0, .y = 0, .width = 938, .height = 540, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Background/1.png", .id = .STAGE_TEST00_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Stage/Test00/Platforms/1.png", .id = .STAGE_TEST00_PLATFORMS, .trim = .{ .x = 290, .y = 557, .width = 1396, .height = 523, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/1.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 1, .y = 3, .width = 912, .height = 525, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/2.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 7, .y = 7, .width = 912, .height = 525, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/3.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 13, .y = 11, .width = 912, .height = 525, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/4.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 19, .y = 17, .width = 912, .height = 523, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/5.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 27, .y = 17, .width = 912, .height = 523, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/6.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 35, .y = 13, .width = 905, .height = 523, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/7.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 41, .y = 7, .width = 899, .height = 523, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/8.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 33, .y = 3, .width = 899, .height = 523, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/9.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 25, .y = 3, .width = 899, .height = 523, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/10.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 19, .y = 3, .width = 899, .height = 523, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/11.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 11, .y = 3, .width = 899, .height = 523, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/12.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 5, .y = 5, .width = 899, .height = 523, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/13.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 3, .y = 1, .width = 899, .height = 523, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/14.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 0, .y = 0, .width = 898, .height = 520, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/15.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 0, .y = 6, .width = 892, .height = 520, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Stage/Test00/Thumbnail/16.png", .id = .STAGE_TEST00_THUMBNAIL, .trim = .{ .x = 0, .y = 6, .width = 892, .height = 520, .full_width = 940, .full_height = 540 } },
+    .{ .path = "assets/visual/Ui/Ammo/Equals0/1.png", .id = .UI_AMMO_EQUALS0, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Ammo/Equals1/1.png", .id = .UI_AMMO_EQUALS1, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Ammo/Equals2/1.png", .id = .UI_AMMO_EQUALS2, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Ammo/Equals3/1.png", .id = .UI_AMMO_EQUALS3, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Ammo/Equals4/1.png", .id = .UI_AMMO_EQUALS4, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Ammo/Equals5/1.png", .id = .UI_AMMO_EQUALS5, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Ammo/Equals6/1.png", .id = .UI_AMMO_EQUALS6, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Ammo/Equals7/1.png", .id = .UI_AMMO_EQUALS7, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals0/1.png", .id = .UI_HEALTH_EQUALS0, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals1/1.png", .id = .UI_HEALTH_EQUALS1, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals10/1.png", .id = .UI_HEALTH_EQUALS10, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals11/1.png", .id = .UI_HEALTH_EQUALS11, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals12/1.png", .id = .UI_HEALTH_EQUALS12, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals13/1.png", .id = .UI_HEALTH_EQUALS13, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals14/1.png", .id = .UI_HEALTH_EQUALS14, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals15/1.png", .id = .UI_HEALTH_EQUALS15, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals2/1.png", .id = .UI_HEALTH_EQUALS2, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals3/1.png", .id = .UI_HEALTH_EQUALS3, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals4/1.png", .id = .UI_HEALTH_EQUALS4, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals5/1.png", .id = .UI_HEALTH_EQUALS5, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals6/1.png", .id = .UI_HEALTH_EQUALS6, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals7/1.png", .id = .UI_HEALTH_EQUALS7, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals8/1.png", .id = .UI_HEALTH_EQUALS8, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Health/Equals9/1.png", .id = .UI_HEALTH_EQUALS9, .trim = .{ .x = 10, .y = 10, .width = 310, .height = 78, .full_width = 339, .full_height = 94 } },
+    .{ .path = "assets/visual/Ui/Loading/Assets/1.png", .id = .UI_LOADING_ASSETS, .trim = .{ .x = 0, .y = 0, .width = 664, .height = 241, .full_width = 664, .full_height = 241 } },
+    .{ .path = "assets/visual/Ui/Loading/Assets/2.png", .id = .UI_LOADING_ASSETS, .trim = .{ .x = 0, .y = 0, .width = 664, .height = 241, .full_width = 664, .full_height = 241 } },
+    .{ .path = "assets/visual/Ui/Loading/Assets/3.png", .id = .UI_LOADING_ASSETS, .trim = .{ .x = 0, .y = 0, .width = 664, .height = 241, .full_width = 664, .full_height = 241 } },
+    .{ .path = "assets/visual/Ui/Loading/Assets/4.png", .id = .UI_LOADING_ASSETS, .trim = .{ .x = 0, .y = 0, .width = 664, .height = 241, .full_width = 664, .full_height = 241 } },
+    .{ .path = "assets/visual/Ui/Loading/Assets/5.png", .id = .UI_LOADING_ASSETS, .trim = .{ .x = 0, .y = 0, .width = 664, .height = 241, .full_width = 664, .full_height = 241 } },
+    .{ .path = "assets/visual/Ui/Loading/Assets/6.png", .id = .UI_LOADING_ASSETS, .trim = .{ .x = 0, .y = 0, .width = 664, .height = 241, .full_width = 664, .full_height = 241 } },
+    .{ .path = "assets/visual/Ui/Loading/Assets/7.png", .id = .UI_LOADING_ASSETS, .trim = .{ .x = 0, .y = 0, .width = 664, .height = 241, .full_width = 664, .full_height = 241 } },
+    .{ .path = "assets/visual/Ui/Loading/Assets/8.png", .id = .UI_LOADING_ASSETS, .trim = .{ .x = 0, .y = 0, .width = 664, .height = 241, .full_width = 664, .full_height = 241 } },
+    .{ .path = "assets/visual/Ui/Loading/Assets/9.png", .id = .UI_LOADING_ASSETS, .trim = .{ .x = 0, .y = 0, .width = 664, .height = 241, .full_width = 664, .full_height = 241 } },
+    .{ .path = "assets/visual/Ui/Loading/Assets/10.png", .id = .UI_LOADING_ASSETS, .trim = .{ .x = 0, .y = 0, .width = 664, .height = 241, .full_width = 664, .full_height = 241 } },
+    .{ .path = "assets/visual/Ui/Loading/Assets/11.png", .id = .UI_LOADING_ASSETS, .trim = .{ .x = 0, .y = 0, .width = 664, .height = 241, .full_width = 664, .full_height = 241 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/2.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/3.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/4.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/5.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/6.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/7.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/8.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/9.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/10.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/11.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/12.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/13.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/14.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Paused/Background/15.png", .id = .UI_PAUSED_BACKGROUND, .trim = .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/1.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/2.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/3.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/4.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/5.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/6.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/7.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/8.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/9.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/10.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/11.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/12.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/NotPlaying/13.png", .id = .UI_PLAYER_NOTPLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/1.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/2.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/3.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/4.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/5.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/6.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/7.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/8.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/9.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/10.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/11.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/12.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Player/Playing/13.png", .id = .UI_PLAYER_PLAYING, .trim = .{ .x = 7, .y = 4, .width = 64, .height = 64, .full_width = 75, .full_height = 75 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/1.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 184, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/2.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 268, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/3.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 268, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/4.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 268, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/5.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 268, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/6.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 268, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/7.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 268, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/8.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 268, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/9.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/10.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/11.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/12.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/13.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/14.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/15.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/16.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/17.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/18.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/19.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/20.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/21.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/22.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/23.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/24.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/25.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/26.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/27.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/28.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/29.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
+    .{ .path = "assets/visual/Ui/Quitting/Game/30.png", .id = .UI_QUITTING_GAME, .trim = .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 } },
 };
 
-pub const MenuStageMode = enum(u16) {
-    SELECTED,
-};
+pub const ASSETS_PER_ID: [ID.size()]usize = .{ 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 6, 12, 12, 12, 12, 5, 5, 5, 5, 5, 5, 6, 1, 12, 1, 10, 10, 10, 10, 1, 1, 1, 10, 1, 1, 16, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 11, 14, 13, 13, 30 };
 
-pub const ALL: [358]Asset = .{
-    .{ .path = "assets/visual/Character/Test/Flying_Right/1.png", .id = .CHARACTER_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Flying_Right/2.png", .id = .CHARACTER_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Flying_Right/3.png", .id = .CHARACTER_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Flying_Right/4.png", .id = .CHARACTER_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Flying_Right/5.png", .id = .CHARACTER_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Standing/1.png", .id = .CHARACTER_TEST_STANDING },
-    .{ .path = "assets/visual/Character/Test/Standing/2.png", .id = .CHARACTER_TEST_STANDING },
-    .{ .path = "assets/visual/Character/Test/Standing/3.png", .id = .CHARACTER_TEST_STANDING },
-    .{ .path = "assets/visual/Character/Test/Standing/4.png", .id = .CHARACTER_TEST_STANDING },
-    .{ .path = "assets/visual/Character/Test/Standing/5.png", .id = .CHARACTER_TEST_STANDING },
-    .{ .path = "assets/visual/Character/Test/Standing/6.png", .id = .CHARACTER_TEST_STANDING },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/1.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/2.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/3.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/4.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/5.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/6.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/7.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/8.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/9.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/10.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/11.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Left/12.png", .id = .CHARACTER_TEST_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Flying_Left/1.png", .id = .CHARACTER_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Flying_Left/2.png", .id = .CHARACTER_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Flying_Left/3.png", .id = .CHARACTER_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Flying_Left/4.png", .id = .CHARACTER_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Flying_Left/5.png", .id = .CHARACTER_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Running_Right/1.png", .id = .CHARACTER_TEST_RUNNING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Running_Right/2.png", .id = .CHARACTER_TEST_RUNNING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Running_Right/3.png", .id = .CHARACTER_TEST_RUNNING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Running_Right/4.png", .id = .CHARACTER_TEST_RUNNING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Running_Right/5.png", .id = .CHARACTER_TEST_RUNNING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/1.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/2.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/3.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/4.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/5.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/6.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/7.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/8.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/9.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/10.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/11.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Right/12.png", .id = .CHARACTER_TEST_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Test/Running_Left/1.png", .id = .CHARACTER_TEST_RUNNING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Running_Left/2.png", .id = .CHARACTER_TEST_RUNNING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Running_Left/3.png", .id = .CHARACTER_TEST_RUNNING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Running_Left/4.png", .id = .CHARACTER_TEST_RUNNING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Running_Left/5.png", .id = .CHARACTER_TEST_RUNNING_LEFT },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/1.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/2.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/3.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/4.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/5.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/6.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/7.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/8.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/9.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/10.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/11.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Down/12.png", .id = .CHARACTER_TEST_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/1.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/2.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/3.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/4.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/5.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/6.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/7.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/8.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/9.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/10.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/11.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Attacking_Up/12.png", .id = .CHARACTER_TEST_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Test/Flying_Neutral/1.png", .id = .CHARACTER_TEST_FLYING_NEUTRAL },
-    .{ .path = "assets/visual/Character/Test/Flying_Neutral/2.png", .id = .CHARACTER_TEST_FLYING_NEUTRAL },
-    .{ .path = "assets/visual/Character/Test/Flying_Neutral/3.png", .id = .CHARACTER_TEST_FLYING_NEUTRAL },
-    .{ .path = "assets/visual/Character/Test/Flying_Neutral/4.png", .id = .CHARACTER_TEST_FLYING_NEUTRAL },
-    .{ .path = "assets/visual/Character/Test/Flying_Neutral/5.png", .id = .CHARACTER_TEST_FLYING_NEUTRAL },
-    .{ .path = "assets/visual/Character/Test/Jumping/1.png", .id = .CHARACTER_TEST_JUMPING },
-    .{ .path = "assets/visual/Character/Test/Jumping/2.png", .id = .CHARACTER_TEST_JUMPING },
-    .{ .path = "assets/visual/Character/Test/Jumping/3.png", .id = .CHARACTER_TEST_JUMPING },
-    .{ .path = "assets/visual/Character/Test/Jumping/4.png", .id = .CHARACTER_TEST_JUMPING },
-    .{ .path = "assets/visual/Character/Test/Jumping/5.png", .id = .CHARACTER_TEST_JUMPING },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Right/1.png", .id = .CHARACTER_WURMPLE_FLYING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Right/2.png", .id = .CHARACTER_WURMPLE_FLYING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Right/3.png", .id = .CHARACTER_WURMPLE_FLYING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Right/4.png", .id = .CHARACTER_WURMPLE_FLYING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Right/5.png", .id = .CHARACTER_WURMPLE_FLYING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Standing/1.png", .id = .CHARACTER_WURMPLE_STANDING },
-    .{ .path = "assets/visual/Character/Wurmple/Standing/2.png", .id = .CHARACTER_WURMPLE_STANDING },
-    .{ .path = "assets/visual/Character/Wurmple/Standing/3.png", .id = .CHARACTER_WURMPLE_STANDING },
-    .{ .path = "assets/visual/Character/Wurmple/Standing/4.png", .id = .CHARACTER_WURMPLE_STANDING },
-    .{ .path = "assets/visual/Character/Wurmple/Standing/5.png", .id = .CHARACTER_WURMPLE_STANDING },
-    .{ .path = "assets/visual/Character/Wurmple/Standing/6.png", .id = .CHARACTER_WURMPLE_STANDING },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/1.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/2.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/3.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/4.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/5.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/6.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/7.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/8.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/9.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/10.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/11.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Left/12.png", .id = .CHARACTER_WURMPLE_ATTACKING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Left/1.png", .id = .CHARACTER_WURMPLE_FLYING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Left/2.png", .id = .CHARACTER_WURMPLE_FLYING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Left/3.png", .id = .CHARACTER_WURMPLE_FLYING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Left/4.png", .id = .CHARACTER_WURMPLE_FLYING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Left/5.png", .id = .CHARACTER_WURMPLE_FLYING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Running_Right/1.png", .id = .CHARACTER_WURMPLE_RUNNING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Running_Right/2.png", .id = .CHARACTER_WURMPLE_RUNNING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Running_Right/3.png", .id = .CHARACTER_WURMPLE_RUNNING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Running_Right/4.png", .id = .CHARACTER_WURMPLE_RUNNING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Running_Right/5.png", .id = .CHARACTER_WURMPLE_RUNNING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/1.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/2.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/3.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/4.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/5.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/6.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/7.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/8.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/9.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/10.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/11.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Right/12.png", .id = .CHARACTER_WURMPLE_ATTACKING_RIGHT },
-    .{ .path = "assets/visual/Character/Wurmple/Running_Left/1.png", .id = .CHARACTER_WURMPLE_RUNNING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Running_Left/2.png", .id = .CHARACTER_WURMPLE_RUNNING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Running_Left/3.png", .id = .CHARACTER_WURMPLE_RUNNING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Running_Left/4.png", .id = .CHARACTER_WURMPLE_RUNNING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Running_Left/5.png", .id = .CHARACTER_WURMPLE_RUNNING_LEFT },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/1.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/2.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/3.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/4.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/5.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/6.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/7.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/8.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/9.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/10.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/11.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Down/12.png", .id = .CHARACTER_WURMPLE_ATTACKING_DOWN },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/1.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/2.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/3.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/4.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/5.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/6.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/7.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/8.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/9.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/10.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/11.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Attacking_Up/12.png", .id = .CHARACTER_WURMPLE_ATTACKING_UP },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Neutral/1.png", .id = .CHARACTER_WURMPLE_FLYING_NEUTRAL },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Neutral/2.png", .id = .CHARACTER_WURMPLE_FLYING_NEUTRAL },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Neutral/3.png", .id = .CHARACTER_WURMPLE_FLYING_NEUTRAL },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Neutral/4.png", .id = .CHARACTER_WURMPLE_FLYING_NEUTRAL },
-    .{ .path = "assets/visual/Character/Wurmple/Flying_Neutral/5.png", .id = .CHARACTER_WURMPLE_FLYING_NEUTRAL },
-    .{ .path = "assets/visual/Character/Wurmple/Jumping/1.png", .id = .CHARACTER_WURMPLE_JUMPING },
-    .{ .path = "assets/visual/Character/Wurmple/Jumping/2.png", .id = .CHARACTER_WURMPLE_JUMPING },
-    .{ .path = "assets/visual/Character/Wurmple/Jumping/3.png", .id = .CHARACTER_WURMPLE_JUMPING },
-    .{ .path = "assets/visual/Character/Wurmple/Jumping/4.png", .id = .CHARACTER_WURMPLE_JUMPING },
-    .{ .path = "assets/visual/Character/Wurmple/Jumping/5.png", .id = .CHARACTER_WURMPLE_JUMPING },
-    .{ .path = "assets/visual/Dont/Load/Texture/1.png", .id = .DONT_LOAD_TEXTURE },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Down/1.png", .id = .PROJECTILE_TEST_FLYING_DOWN },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Down/2.png", .id = .PROJECTILE_TEST_FLYING_DOWN },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Down/3.png", .id = .PROJECTILE_TEST_FLYING_DOWN },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Down/4.png", .id = .PROJECTILE_TEST_FLYING_DOWN },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Down/5.png", .id = .PROJECTILE_TEST_FLYING_DOWN },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Down/6.png", .id = .PROJECTILE_TEST_FLYING_DOWN },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Down/7.png", .id = .PROJECTILE_TEST_FLYING_DOWN },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Down/8.png", .id = .PROJECTILE_TEST_FLYING_DOWN },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Down/9.png", .id = .PROJECTILE_TEST_FLYING_DOWN },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Down/10.png", .id = .PROJECTILE_TEST_FLYING_DOWN },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Right/1.png", .id = .PROJECTILE_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Right/2.png", .id = .PROJECTILE_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Right/3.png", .id = .PROJECTILE_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Right/4.png", .id = .PROJECTILE_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Right/5.png", .id = .PROJECTILE_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Right/6.png", .id = .PROJECTILE_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Right/7.png", .id = .PROJECTILE_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Right/8.png", .id = .PROJECTILE_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Right/9.png", .id = .PROJECTILE_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Right/10.png", .id = .PROJECTILE_TEST_FLYING_RIGHT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Left/1.png", .id = .PROJECTILE_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Left/2.png", .id = .PROJECTILE_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Left/3.png", .id = .PROJECTILE_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Left/4.png", .id = .PROJECTILE_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Left/5.png", .id = .PROJECTILE_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Left/6.png", .id = .PROJECTILE_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Left/7.png", .id = .PROJECTILE_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Left/8.png", .id = .PROJECTILE_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Left/9.png", .id = .PROJECTILE_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Left/10.png", .id = .PROJECTILE_TEST_FLYING_LEFT },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Up/1.png", .id = .PROJECTILE_TEST_FLYING_UP },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Up/2.png", .id = .PROJECTILE_TEST_FLYING_UP },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Up/3.png", .id = .PROJECTILE_TEST_FLYING_UP },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Up/4.png", .id = .PROJECTILE_TEST_FLYING_UP },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Up/5.png", .id = .PROJECTILE_TEST_FLYING_UP },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Up/6.png", .id = .PROJECTILE_TEST_FLYING_UP },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Up/7.png", .id = .PROJECTILE_TEST_FLYING_UP },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Up/8.png", .id = .PROJECTILE_TEST_FLYING_UP },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Up/9.png", .id = .PROJECTILE_TEST_FLYING_UP },
-    .{ .path = "assets/visual/Projectile/Test/Flying_Up/10.png", .id = .PROJECTILE_TEST_FLYING_UP },
-    .{ .path = "assets/visual/Ui/Ammo/Equals4/1.png", .id = .UI_AMMO_EQUALS4 },
-    .{ .path = "assets/visual/Ui/Ammo/Equals1/1.png", .id = .UI_AMMO_EQUALS1 },
-    .{ .path = "assets/visual/Ui/Ammo/Equals7/1.png", .id = .UI_AMMO_EQUALS7 },
-    .{ .path = "assets/visual/Ui/Ammo/Equals2/1.png", .id = .UI_AMMO_EQUALS2 },
-    .{ .path = "assets/visual/Ui/Ammo/Equals6/1.png", .id = .UI_AMMO_EQUALS6 },
-    .{ .path = "assets/visual/Ui/Ammo/Equals0/1.png", .id = .UI_AMMO_EQUALS0 },
-    .{ .path = "assets/visual/Ui/Ammo/Equals3/1.png", .id = .UI_AMMO_EQUALS3 },
-    .{ .path = "assets/visual/Ui/Ammo/Equals5/1.png", .id = .UI_AMMO_EQUALS5 },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/1.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/2.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/3.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/4.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/5.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/6.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/7.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/8.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/9.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/10.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/11.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/12.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/NotPlaying/13.png", .id = .UI_PLAYER_NOTPLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/1.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/2.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/3.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/4.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/5.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/6.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/7.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/8.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/9.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/10.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/11.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/12.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Player/Playing/13.png", .id = .UI_PLAYER_PLAYING },
-    .{ .path = "assets/visual/Ui/Health/Equals4/1.png", .id = .UI_HEALTH_EQUALS4 },
-    .{ .path = "assets/visual/Ui/Health/Equals11/1.png", .id = .UI_HEALTH_EQUALS11 },
-    .{ .path = "assets/visual/Ui/Health/Equals1/1.png", .id = .UI_HEALTH_EQUALS1 },
-    .{ .path = "assets/visual/Ui/Health/Equals15/1.png", .id = .UI_HEALTH_EQUALS15 },
-    .{ .path = "assets/visual/Ui/Health/Equals8/1.png", .id = .UI_HEALTH_EQUALS8 },
-    .{ .path = "assets/visual/Ui/Health/Equals14/1.png", .id = .UI_HEALTH_EQUALS14 },
-    .{ .path = "assets/visual/Ui/Health/Equals12/1.png", .id = .UI_HEALTH_EQUALS12 },
-    .{ .path = "assets/visual/Ui/Health/Equals7/1.png", .id = .UI_HEALTH_EQUALS7 },
-    .{ .path = "assets/visual/Ui/Health/Equals2/1.png", .id = .UI_HEALTH_EQUALS2 },
-    .{ .path = "assets/visual/Ui/Health/Equals6/1.png", .id = .UI_HEALTH_EQUALS6 },
-    .{ .path = "assets/visual/Ui/Health/Equals9/1.png", .id = .UI_HEALTH_EQUALS9 },
-    .{ .path = "assets/visual/Ui/Health/Equals10/1.png", .id = .UI_HEALTH_EQUALS10 },
-    .{ .path = "assets/visual/Ui/Health/Equals0/1.png", .id = .UI_HEALTH_EQUALS0 },
-    .{ .path = "assets/visual/Ui/Health/Equals13/1.png", .id = .UI_HEALTH_EQUALS13 },
-    .{ .path = "assets/visual/Ui/Health/Equals3/1.png", .id = .UI_HEALTH_EQUALS3 },
-    .{ .path = "assets/visual/Ui/Health/Equals5/1.png", .id = .UI_HEALTH_EQUALS5 },
-    .{ .path = "assets/visual/Ui/Quitting/Game/1.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/2.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/3.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/4.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/5.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/6.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/7.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/8.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/9.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/10.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/11.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/12.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/13.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/14.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/15.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/16.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/17.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/18.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/19.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/20.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/21.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/22.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/23.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/24.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/25.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/26.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/27.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/28.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/29.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Quitting/Game/30.png", .id = .UI_QUITTING_GAME },
-    .{ .path = "assets/visual/Ui/Loading/Assets/1.png", .id = .UI_LOADING_ASSETS },
-    .{ .path = "assets/visual/Ui/Loading/Assets/2.png", .id = .UI_LOADING_ASSETS },
-    .{ .path = "assets/visual/Ui/Loading/Assets/3.png", .id = .UI_LOADING_ASSETS },
-    .{ .path = "assets/visual/Ui/Loading/Assets/4.png", .id = .UI_LOADING_ASSETS },
-    .{ .path = "assets/visual/Ui/Loading/Assets/5.png", .id = .UI_LOADING_ASSETS },
-    .{ .path = "assets/visual/Ui/Loading/Assets/6.png", .id = .UI_LOADING_ASSETS },
-    .{ .path = "assets/visual/Ui/Loading/Assets/7.png", .id = .UI_LOADING_ASSETS },
-    .{ .path = "assets/visual/Ui/Loading/Assets/8.png", .id = .UI_LOADING_ASSETS },
-    .{ .path = "assets/visual/Ui/Loading/Assets/9.png", .id = .UI_LOADING_ASSETS },
-    .{ .path = "assets/visual/Ui/Loading/Assets/10.png", .id = .UI_LOADING_ASSETS },
-    .{ .path = "assets/visual/Ui/Loading/Assets/11.png", .id = .UI_LOADING_ASSETS },
-    .{ .path = "assets/visual/Ui/Paused/Background/2.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/3.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/4.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/5.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/6.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/7.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/8.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/9.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/10.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/11.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/12.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/13.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/14.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Ui/Paused/Background/15.png", .id = .UI_PAUSED_BACKGROUND },
-    .{ .path = "assets/visual/Stage/Meteor/Background/1.png", .id = .STAGE_METEOR_BACKGROUND },
-    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/1.png", .id = .STAGE_METEOR_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/2.png", .id = .STAGE_METEOR_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/3.png", .id = .STAGE_METEOR_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/4.png", .id = .STAGE_METEOR_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/5.png", .id = .STAGE_METEOR_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/6.png", .id = .STAGE_METEOR_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/7.png", .id = .STAGE_METEOR_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/8.png", .id = .STAGE_METEOR_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/9.png", .id = .STAGE_METEOR_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Meteor/Thumbnail/10.png", .id = .STAGE_METEOR_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Meteor/Platforms/1.png", .id = .STAGE_METEOR_PLATFORMS },
-    .{ .path = "assets/visual/Stage/Meteor/Floor/1.png", .id = .STAGE_METEOR_FLOOR },
-    .{ .path = "assets/visual/Stage/Test00/Background/1.png", .id = .STAGE_TEST00_BACKGROUND },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/1.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/2.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/3.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/4.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/5.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/6.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/7.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/8.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/9.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/10.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/11.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/12.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/13.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/14.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/15.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Thumbnail/16.png", .id = .STAGE_TEST00_THUMBNAIL },
-    .{ .path = "assets/visual/Stage/Test00/Platforms/1.png", .id = .STAGE_TEST00_PLATFORMS },
-    .{ .path = "assets/visual/Menu/Waiting/ForInput/1.png", .id = .MENU_WAITING_FORINPUT },
-    .{ .path = "assets/visual/Menu/Stage/Selected/1.png", .id = .MENU_STAGE_SELECTED },
-    .{ .path = "assets/visual/Menu/Stage/Selected/2.png", .id = .MENU_STAGE_SELECTED },
-    .{ .path = "assets/visual/Menu/Stage/Selected/3.png", .id = .MENU_STAGE_SELECTED },
-    .{ .path = "assets/visual/Menu/Stage/Selected/4.png", .id = .MENU_STAGE_SELECTED },
-    .{ .path = "assets/visual/Menu/Stage/Selected/5.png", .id = .MENU_STAGE_SELECTED },
-    .{ .path = "assets/visual/Menu/Stage/Selected/6.png", .id = .MENU_STAGE_SELECTED },
-    .{ .path = "assets/visual/Menu/Stage/Selected/7.png", .id = .MENU_STAGE_SELECTED },
-    .{ .path = "assets/visual/Menu/Stage/Selected/8.png", .id = .MENU_STAGE_SELECTED },
-    .{ .path = "assets/visual/Menu/Stage/Selected/9.png", .id = .MENU_STAGE_SELECTED },
-    .{ .path = "assets/visual/Menu/Stage/Selected/10.png", .id = .MENU_STAGE_SELECTED },
-    .{ .path = "assets/visual/Menu/Stage/Selected/11.png", .id = .MENU_STAGE_SELECTED },
-    .{ .path = "assets/visual/Menu/Stage/Selected/12.png", .id = .MENU_STAGE_SELECTED },
+// Textures are loaded and evicted one group at a time. A group is a character, a stage, or a menu/UI element.
+// Stage thumbnails get a group of their own, since they are shown while stages themselves aren't needed.
+pub const Group = enum(u16) {
+    CHARACTER_TEST,
+    CHARACTER_WURMPLE,
+    DONT_LOAD,
+    MENU_STAGE,
+    MENU_WAITING,
+    PROJECTILE_TEST,
+    STAGE_METEOR,
+    STAGE_THUMBNAILS,
+    STAGE_TEST00,
+    UI_AMMO,
+    UI_HEALTH,
+    UI_LOADING,
+    UI_PAUSED,
+    UI_PLAYER,
+    UI_QUITTING,
+
+    pub inline fn int(group: Group) u16 {
+        return @intFromEnum(group);
+    }
+
+    pub inline fn size() u16 {
+        return fields(Group).len;
+    }
 };
 
-pub const ASSETS_PER_ID: [ID.size()]usize = .{ 5, 6, 12, 5, 5, 12, 5, 12, 12, 5, 5, 5, 6, 12, 5, 5, 12, 5, 12, 12, 5, 5, 1, 10, 10, 10, 10, 1, 1, 1, 1, 1, 1, 1, 1, 13, 13, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 30, 11, 14, 1, 10, 1, 1, 1, 16, 1, 1, 12 };
+pub const GROUP_PER_ID: [ID.size()]Group = .{ .CHARACTER_TEST, .CHARACTER_TEST, .CHARACTER_TEST, .CHARACTER_TEST, .CHARACTER_TEST, .CHARACTER_TEST, .CHARACTER_TEST, .CHARACTER_TEST, .CHARACTER_TEST, .CHARACTER_TEST, .CHARACTER_TEST, .CHARACTER_WURMPLE, .CHARACTER_WURMPLE, .CHARACTER_WURMPLE, .CHARACTER_WURMPLE, .CHARACTER_WURMPLE, .CHARACTER_WURMPLE, .CHARACTER_WURMPLE, .CHARACTER_WURMPLE, .CHARACTER_WURMPLE, .CHARACTER_WURMPLE, .CHARACTER_WURMPLE, .DONT_LOAD, .MENU_STAGE, .MENU_WAITING, .PROJECTILE_TEST, .PROJECTILE_TEST, .PROJECTILE_TEST, .PROJECTILE_TEST, .STAGE_METEOR, .STAGE_METEOR, .STAGE_METEOR, .STAGE_THUMBNAILS, .STAGE_TEST00, .STAGE_TEST00, .STAGE_THUMBNAILS, .UI_AMMO, .UI_AMMO, .UI_AMMO, .UI_AMMO, .UI_AMMO, .UI_AMMO, .UI_AMMO, .UI_AMMO, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_HEALTH, .UI_LOADING, .UI_PAUSED, .UI_PLAYER, .UI_PLAYER, .UI_QUITTING };
+
+// Delta encoded animations are drawn on one canvas covering every frame, and only the region that changes
+// from one frame to the next is stored and uploaded. Null for animations stored frame by frame.
+pub const DELTA_CANVAS_PER_ID: [ID.size()]?Trim = .{
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 },
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    .{ .x = 0, .y = 0, .width = 940, .height = 540, .full_width = 940, .full_height = 540 },
+    null,
+    null,
+    .{ .x = 0, .y = 0, .width = 940, .height = 540, .full_width = 940, .full_height = 540 },
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    null,
+    .{ .x = 0, .y = 0, .width = 1920, .height = 1080, .full_width = 1920, .full_height = 1080 },
+    null,
+    null,
+    .{ .x = 566, .y = 352, .width = 794, .height = 269, .full_width = 1920, .full_height = 1080 },
+};
 
 // Storage for textures to be initialized at runtime.
-var character_test_flying_right_textures: [5]Texture = undefined;
-var character_test_standing_textures: [6]Texture = undefined;
+var character_test_attacking_down_textures: [12]Texture = undefined;
 var character_test_attacking_left_textures: [12]Texture = undefined;
-var character_test_flying_left_textures: [5]Texture = undefined;
-var character_test_running_right_textures: [5]Texture = undefined;
 var character_test_attacking_right_textures: [12]Texture = undefined;
-var character_test_running_left_textures: [5]Texture = undefined;
-var character_test_attacking_down_textures: [12]Texture = undefined;
 var character_test_attacking_up_textures: [12]Texture = undefined;
+var character_test_flying_left_textures: [5]Texture = undefined;
 var character_test_flying_neutral_textures: [5]Texture = undefined;
+var character_test_flying_right_textures: [5]Texture = undefined;
 var character_test_jumping_textures: [5]Texture = undefined;
-var character_wurmple_flying_right_textures: [5]Texture = undefined;
-var character_wurmple_standing_textures: [6]Texture = undefined;
+var character_test_running_left_textures: [5]Texture = undefined;
+var character_test_running_right_textures: [5]Texture = undefined;
+var character_test_standing_textures: [6]Texture = undefined;
+var character_wurmple_attacking_down_textures: [12]Texture = undefined;
 var character_wurmple_attacking_left_textures: [12]Texture = undefined;
-var character_wurmple_flying_left_textures: [5]Texture = undefined;
-var character_wurmple_running_right_textures: [5]Texture = undefined;
 var character_wurmple_attacking_right_textures: [12]Texture = undefined;
-var character_wurmple_running_left_textures: [5]Texture = undefined;
-var character_wurmple_attacking_down_textures: [12]Texture = undefined;
 var character_wurmple_attacking_up_textures: [12]Texture = undefined;
+var character_wurmple_flying_left_textures: [5]Texture = undefined;
 var character_wurmple_flying_neutral_textures: [5]Texture = undefined;
+var character_wurmple_flying_right_textures: [5]Texture = undefined;
 var character_wurmple_jumping_textures: [5]Texture = undefined;
+var character_wurmple_running_left_textures: [5]Texture = undefined;
+var character_wurmple_running_right_textures: [5]Texture = undefined;
+var character_wurmple_standing_textures: [6]Texture = undefined;
 var dont_load_texture_textures: [1]Texture = undefined;
+var menu_stage_selected_textures: [12]Texture = undefined;
+var menu_waiting_forinput_textures: [1]Texture = undefined;
 var projectile_test_flying_down_textures: [10]Texture = undefined;
-var projectile_test_flying_right_textures: [10]Texture = undefined;
 var projectile_test_flying_left_textures: [10]Texture = undefined;
+var projectile_test_flying_right_textures: [10]Texture = undefined;
 var projectile_test_flying_up_textures: [10]Texture = undefined;
-var ui_ammo_equals4_textures: [1]Texture = undefined;
+var stage_meteor_background_textures: [1]Texture = undefined;
+var stage_meteor_floor_textures: [1]Texture = undefined;
+var stage_meteor_platforms_textures: [1]Texture = undefined;
+var stage_meteor_thumbnail_textures: [10]Texture = undefined;
+var stage_test00_background_textures: [1]Texture = undefined;
+var stage_test00_platforms_textures: [1]Texture = undefined;
+var stage_test00_thumbnail_textures: [16]Texture = undefined;
+var ui_ammo_equals0_textures: [1]Texture = undefined;
 var ui_ammo_equals1_textures: [1]Texture = undefined;
-var ui_ammo_equals7_textures: [1]Texture = undefined;
 var ui_ammo_equals2_textures: [1]Texture = undefined;
-var ui_ammo_equals6_textures: [1]Texture = undefined;
-var ui_ammo_equals0_textures: [1]Texture = undefined;
 var ui_ammo_equals3_textures: [1]Texture = undefined;
+var ui_ammo_equals4_textures: [1]Texture = undefined;
 var ui_ammo_equals5_textures: [1]Texture = undefined;
-var ui_player_notplaying_textures: [13]Texture = undefined;
-var ui_player_playing_textures: [13]Texture = undefined;
-var ui_health_equals4_textures: [1]Texture = undefined;
-var ui_health_equals11_textures: [1]Texture = undefined;
+var ui_ammo_equals6_textures: [1]Texture = undefined;
+var ui_ammo_equals7_textures: [1]Texture = undefined;
+var ui_health_equals0_textures: [1]Texture = undefined;
 var ui_health_equals1_textures: [1]Texture = undefined;
-var ui_health_equals15_textures: [1]Texture = undefined;
-var ui_health_equals8_textures: [1]Texture = undefined;
-var ui_health_equals14_textures: [1]Texture = undefined;
-var ui_health_equals12_textures: [1]Texture = undefined;
-var ui_health_equals7_textures: [1]Texture = undefined;
-var ui_health_equals2_textures: [1]Texture = undefined;
-var ui_health_equals6_textures: [1]Texture = undefined;
-var ui_health_equals9_textures: [1]Texture = undefined;
 var ui_health_equals10_textures: [1]Texture = undefined;
-var ui_health_equals0_textures: [1]Texture = undefined;
+var ui_health_equals11_textures: [1]Texture = undefined;
+var ui_health_equals12_textures: [1]Texture = undefined;
 var ui_health_equals13_textures: [1]Texture = undefined;
+var ui_health_equals14_textures: [1]Texture = undefined;
+var ui_health_equals15_textures: [1]Texture = undefined;
+var ui_health_equals2_textures: [1]Texture = undefined;
 var ui_health_equals3_textures: [1]Texture = undefined;
+var ui_health_equals4_textures: [1]Texture = undefined;
 var ui_health_equals5_textures: [1]Texture = undefined;
-var ui_quitting_game_textures: [30]Texture = undefined;
+var ui_health_equals6_textures: [1]Texture = undefined;
+var ui_health_equals7_textures: [1]Texture = undefined;
+var ui_health_equals8_textures: [1]Texture = undefined;
+var ui_health_equals9_textures: [1]Texture = undefined;
 var ui_loading_assets_textures: [11]Texture = undefined;
 var ui_paused_background_textures: [14]Texture = undefined;
-var stage_meteor_background_textures: [1]Texture = undefined;
-var stage_meteor_thumbnail_textures: [10]Texture = undefined;
-var stage_meteor_platforms_textures: [1]Texture = undefined;
-var stage_meteor_floor_textures: [1]Texture = undefined;
-var stage_test00_background_textures: [1]Texture = undefined;
-var stage_test00_thumbnail_textures: [16]Texture = undefined;
-var stage_test00_platforms_textures: [1]Texture = undefined;
-var menu_waiting_forinput_textures: [1]Texture = undefined;
-var menu_stage_selected_textures: [12]Texture = undefined;
+var ui_player_notplaying_textures: [13]Texture = undefined;
+var ui_player_playing_textures: [13]Texture = undefined;
+var ui_quitting_game_textures: [30]Texture = undefined;
 
 pub var texture_slices: [ID.size()][]Texture = .{
-    &character_test_flying_right_textures,
-    &character_test_standing_textures,
+    &character_test_attacking_down_textures,
     &character_test_attacking_left_textures,
-    &character_test_flying_left_textures,
-    &character_test_running_right_textures,
     &character_test_attacking_right_textures,
-    &character_test_running_left_textures,
-    &character_test_attacking_down_textures,
     &character_test_attacking_up_textures,
+    &character_test_flying_left_textures,
     &character_test_flying_neutral_textures,
+    &character_test_flying_right_textures,
     &character_test_jumping_textures,
-    &character_wurmple_flying_right_textures,
-    &character_wurmple_standing_textures,
+    &character_test_running_left_textures,
+    &character_test_running_right_textures,
+    &character_test_standing_textures,
+    &character_wurmple_attacking_down_textures,
     &character_wurmple_attacking_left_textures,
-    &character_wurmple_flying_left_textures,
-    &character_wurmple_running_right_textures,
     &character_wurmple_attacking_right_textures,
-    &character_wurmple_running_left_textures,
-    &character_wurmple_attacking_down_textures,
     &character_wurmple_attacking_up_textures,
+    &character_wurmple_flying_left_textures,
     &character_wurmple_flying_neutral_textures,
+    &character_wurmple_flying_right_textures,
     &character_wurmple_jumping_textures,
+    &character_wurmple_running_left_textures,
+    &character_wurmple_running_right_textures,
+    &character_wurmple_standing_textures,
     &dont_load_texture_textures,
+    &menu_stage_selected_textures,
+    &menu_waiting_forinput_textures,
     &projectile_test_flying_down_textures,
-    &projectile_test_flying_right_textures,
     &projectile_test_flying_left_textures,
+    &projectile_test_flying_right_textures,
     &projectile_test_flying_up_textures,
-    &ui_ammo_equals4_textures,
+    &stage_meteor_background_textures,
+    &stage_meteor_floor_textures,
+    &stage_meteor_platforms_textures,
+    &stage_meteor_thumbnail_textures,
+    &stage_test00_background_textures,
+    &stage_test00_platforms_textures,
+    &stage_test00_thumbnail_textures,
+    &ui_ammo_equals0_textures,
     &ui_ammo_equals1_textures,
-    &ui_ammo_equals7_textures,
     &ui_ammo_equals2_textures,
-    &ui_ammo_equals6_textures,
-    &ui_ammo_equals0_textures,
     &ui_ammo_equals3_textures,
+    &ui_ammo_equals4_textures,
     &ui_ammo_equals5_textures,
-    &ui_player_notplaying_textures,
-    &ui_player_playing_textures,
-    &ui_health_equals4_textures,
-    &ui_health_equals11_textures,
+    &ui_ammo_equals6_textures,
+    &ui_ammo_equals7_textures,
+    &ui_health_equals0_textures,
     &ui_health_equals1_textures,
-    &ui_health_equals15_textures,
-    &ui_health_equals8_textures,
-    &ui_health_equals14_textures,
-    &ui_health_equals12_textures,
-    &ui_health_equals7_textures,
-    &ui_health_equals2_textures,
-    &ui_health_equals6_textures,
-    &ui_health_equals9_textures,
     &ui_health_equals10_textures,
-    &ui_health_equals0_textures,
+    &ui_health_equals11_textures,
+    &ui_health_equals12_textures,
     &ui_health_equals13_textures,
+    &ui_health_equals14_textures,
+    &ui_health_equals15_textures,
+    &ui_health_equals2_textures,
     &ui_health_equals3_textures,
+    &ui_health_equals4_textures,
     &ui_health_equals5_textures,
-    &ui_quitting_game_textures,
+    &ui_health_equals6_textures,
+    &ui_health_equals7_textures,
+    &ui_health_equals8_textures,
+    &ui_health_equals9_textures,
     &ui_loading_assets_textures,
     &ui_paused_background_textures,
-    &stage_meteor_background_textures,
-    &stage_meteor_thumbnail_textures,
-    &stage_meteor_platforms_textures,
-    &stage_meteor_floor_textures,
-    &stage_test00_background_textures,
-    &stage_test00_thumbnail_textures,
-    &stage_test00_platforms_textures,
-    &menu_waiting_forinput_textures,
-    &menu_stage_selected_textures,
+    &ui_player_notplaying_textures,
+    &ui_player_playing_textures,
+    &ui_quitting_game_textures,
 };
@@ -0,0 +1,220 @@
+/// Runs batches of independent tasks on one thread per core, stealing work to even out uneven tasks.
+/// The threads are spawned once, in init(), and sleep between batches, so a batch costs no thread creation.
+const std = @import("std");
+
+pub const WorkStealingPool = struct {
+    pub const MAX_WORKERS = 32;
+
+    threads: [MAX_WORKERS]std.Thread = undefined,
+    num_workers: usize = 0,
+    mutex: std.Thread.Mutex = .{},
+    batch_started: std.Thread.Condition = .{},
+    batch_done: std.Thread.Condition = .{},
+    batch: ?ErasedBatch = null, // The one in flight, between start() and wait().
+    generation: u64 = 0, // Of the last batch started, so a worker never runs a batch twice.
+    num_busy: usize = 0, // Workers still working on the batch.
+    quitting: bool = false,
+
+    const ErasedBatch = struct {
+        pointer: *anyopaque,
+        work: *const fn (pointer: *anyopaque, worker: usize) void,
+    };
+
+    // Spawns one worker per core. self must not move until deinit().
+    pub fn init(self: *WorkStealingPool) void {
+        self.* = .{};
+
+        const num_workers = std.math.clamp(std.Thread.getCpuCount() catch 1, 1, MAX_WORKERS);
+
+        // If a thread can't be spawned, the pool just has fewer workers.
+        for (0..num_workers) |worker| {
+            self.threads[worker] = std.Thread.spawn(.{}, workLoop, .{ self, worker }) catch break;
+            self.num_workers += 1;
+        }
+
+        if (self.num_workers == 0) @panic("Can't spawn any worker thread.");
+    }
+
+    // Waits for the batch in flight, if any, and joins the workers.
+    pub fn deinit(self: *WorkStealingPool) void {
+        self.wait();
+
+        self.mutex.lock();
+        self.quitting = true;
+        self.batch_started.broadcast();
+        self.mutex.unlock();
+
+        for (self.threads[0..self.num_workers]) |thread| {
+            thread.join();
+        }
+    }
+
+    // Hands the batch to the workers and returns right away. One batch runs at a time, so it must be waited for
+    // before starting the next one. batch must not move until wait() returns.
+    pub fn start(self: *WorkStealingPool, batch: anytype) void {
+        const Batch = @TypeOf(batch.*);
+
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        std.debug.assert(self.batch == null);
+
+        self.batch = .{ .pointer = batch, .work = Batch.workErased };
+        self.generation += 1;
+        self.num_busy = self.num_workers;
+        self.batch_started.broadcast();
+    }
+
+    // Blocks until every task of the batch in flight has run.
+    pub fn wait(self: *WorkStealingPool) void {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        while (self.num_busy > 0) {
+            self.batch_done.wait(&self.mutex);
+        }
+        self.batch = null;
+    }
+
+    pub fn run(self: *WorkStealingPool, batch: anytype) void {
+        self.start(batch);
+        self.wait();
+    }
+
+    fn workLoop(self: *WorkStealingPool, worker: usize) void {
+        var last_generation: u64 = 0;
+
+        self.mutex.lock();
+        defer self.mutex.unlock();
+
+        while (true) {
+            while (!self.quitting and self.generation == last_generation) {
+                self.batch_started.wait(&self.mutex);
+            }
+            if (self.quitting) return;
+
+            last_generation = self.generation;
+            const batch = self.batch.?;
+
+            self.mutex.unlock();
+            batch.work(batch.pointer, worker);
+            self.mutex.lock();
+
+            self.num_busy -= 1;
+            if (self.num_busy == 0) self.batch_done.signal();
+        }
+    }
+};
+
+// Tasks are dealt out round-robin in the order given, so pass them sorted largest first: every worker
+// starts on a big task, and runs its own tasks in order. A worker out of tasks steals the last (smallest)
+// remaining task of another worker, so the small ones fill in the gaps at the end of the batch.
+// runTask gets the index of the worker running it.
+pub fn WorkStealingBatch(
+    comptime Task: type,
+    comptime Context: type,
+    comptime runTask: fn (context: Context, task: Task, worker: usize) void,
+) type {
+    return struct {
+        const Self = @This();
+
+        // Tasks of worker w are tasks[w + i * num_queues], for i in [front, back).
+        const Queue = struct {
+            mutex: std.Thread.Mutex = .{},
+            front: usize,
+            back: usize,
+        };
+
+        tasks: []const Task,
+        context: Context,
+        queues: [WorkStealingPool.MAX_WORKERS]Queue,
+        num_queues: usize,
+
+        // Deals the tasks out to the pool's workers. Workers beyond the number of tasks only steal.
+        pub fn init(pool: *const WorkStealingPool, tasks: []const Task, context: Context) Self {
+            var self = Self{
+                .tasks = tasks,
+                .context = context,
+                .queues = undefined,
+                .num_queues = @max(1, @min(pool.num_workers, tasks.len)),
+            };
+
+            for (self.queues[0..self.num_queues], 0..) |*queue, worker| {
+                queue.* = .{ .front = 0, .back = (tasks.len + self.num_queues - 1 - worker) / self.num_queues };
+            }
+
+            return self;
+        }
+
+        fn popOwn(self: *Self, worker: usize) ?usize {
+            if (worker >= self.num_queues) return null;
+
+            const queue = &self.queues[worker];
+            queue.mutex.lock();
+            defer queue.mutex.unlock();
+
+            if (queue.front == queue.back) return null;
+            queue.front += 1;
+
+            return worker + (queue.front - 1) * self.num_queues;
+        }
+
+        fn steal(self: *Self, thief: usize) ?usize {
+            for (1..self.num_queues + 1) |distance| {
+                const victim = (thief + distance) % self.num_queues;
+                if (victim == thief) continue;
+
+                const queue = &self.queues[victim];
+
+                queue.mutex.lock();
+                defer queue.mutex.unlock();
+
+                if (queue.front == queue.back) continue;
+                queue.back -= 1;
+
+                return victim + queue.back * self.num_queues;
+            }
+            return null;
+        }
+
+        // No tasks are added during a batch, so once nothing is left to steal, the worker is done.
+        fn work(self: *Self, worker: usize) void {
+            while (self.popOwn(worker) orelse self.steal(worker)) |task_index| {
+                runTask(self.context, self.tasks[task_index], worker);
+            }
+        }
+
+        fn workErased(pointer: *anyopaque, worker: usize) void {
+            work(@ptrCast(@alignCast(pointer)), worker);
+        }
+    };
+}
+
+test "WorkStealingPool runs every task once, batch after batch" {
+    const Counts = [100]std.atomic.Value(u32);
+
+    const Batch = WorkStealingBatch(usize, *Counts, struct {
+        fn increment(counts: *Counts, task: usize, worker: usize) void {
+            _ = worker;
+            _ = counts[task].fetchAdd(1, .monotonic);
+        }
+    }.increment);
+
+    var pool: WorkStealingPool = undefined;
+    pool.init();
+    defer pool.deinit();
+
+    var counts: Counts = .{std.atomic.Value(u32).init(0)} ** 100;
+    var tasks: [100]usize = undefined;
+    for (&tasks, 0..) |*task, i| task.* = i;
+
+    // Fewer tasks than workers too, and none at all.
+    for ([_]usize{ 100, 1, 0, 100 }) |num_tasks| {
+        var batch = Batch.init(&pool, tasks[0..num_tasks], &counts);
+        pool.run(&batch);
+    }
+
+    for (counts, 0..) |count, i| {
+        try std.testing.expectEqual(if (i == 0) 3 else 2, count.load(.monotonic));
+    }
+}